@@ -0,0 +1,76 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    std::atomic<std::size_t> allocations{0};
+
+    void* counted_allocate(std::size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        void* p = std::malloc(size > 0 ? size : 1);
+        if (p == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+} // namespace
+
+namespace jsoncons_benchmarks {
+
+    std::size_t allocation_count() noexcept
+    {
+        return allocations.load(std::memory_order_relaxed);
+    }
+
+} // namespace jsoncons_benchmarks
+
+void* operator new(std::size_t size)
+{
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return counted_allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
@@ -0,0 +1,44 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#ifndef JSONCONS_BENCHMARKS_ALLOCATION_COUNTER_HPP
+#define JSONCONS_BENCHMARKS_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+namespace jsoncons_benchmarks {
+
+    // Number of calls to global operator new since the program started,
+    // counted by the replacements in allocation_counter.cpp
+    std::size_t allocation_count() noexcept;
+
+    // Reports throughput and allocations per document for a benchmark that
+    // processes a document of the given size on every iteration
+    class document_counters
+    {
+        benchmark::State& state_;
+        std::size_t bytes_;
+        std::size_t start_count_;
+    public:
+        document_counters(benchmark::State& state, std::size_t bytes)
+            : state_(state), bytes_(bytes), start_count_(allocation_count())
+        {
+        }
+
+        document_counters(const document_counters&) = delete;
+        document_counters& operator=(const document_counters&) = delete;
+
+        ~document_counters()
+        {
+            std::size_t count = allocation_count() - start_count_;
+            state_.SetBytesProcessed(static_cast<int64_t>(state_.iterations()) * static_cast<int64_t>(bytes_));
+            state_.counters["allocs/doc"] = benchmark::Counter(static_cast<double>(count), benchmark::Counter::kAvgIterations);
+        }
+    };
+
+} // namespace jsoncons_benchmarks
+
+#endif // JSONCONS_BENCHMARKS_ALLOCATION_COUNTER_HPP
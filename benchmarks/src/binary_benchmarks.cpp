@@ -0,0 +1,82 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/bson/bson.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/csv/csv.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/ubjson/ubjson.hpp>
+
+#include "allocation_counter.hpp"
+#include "corpus.hpp"
+
+using jsoncons_benchmarks::document_counters;
+
+using corpus_function = const std::string& (*)();
+
+// Each iteration encodes a document and decodes it again, throughput is
+// measured against the size of the encoded form
+
+#define JSONCONS_BENCHMARK_ROUND_TRIP(name, encode, decode) \
+static void name(benchmark::State& state, corpus_function corpus) \
+{ \
+    const jsoncons::json j = jsoncons::json::parse(corpus()); \
+    std::vector<uint8_t> data; \
+    encode(j, data); \
+    document_counters counters(state, data.size()); \
+    for (auto _ : state) \
+    { \
+        data.clear(); \
+        encode(j, data); \
+        jsoncons::json result = decode<jsoncons::json>(data); \
+        benchmark::DoNotOptimize(result); \
+    } \
+}
+
+JSONCONS_BENCHMARK_ROUND_TRIP(cbor_round_trip, jsoncons::cbor::encode_cbor, jsoncons::cbor::decode_cbor)
+JSONCONS_BENCHMARK_ROUND_TRIP(msgpack_round_trip, jsoncons::msgpack::encode_msgpack, jsoncons::msgpack::decode_msgpack)
+JSONCONS_BENCHMARK_ROUND_TRIP(bson_round_trip, jsoncons::bson::encode_bson, jsoncons::bson::decode_bson)
+JSONCONS_BENCHMARK_ROUND_TRIP(ubjson_round_trip, jsoncons::ubjson::encode_ubjson, jsoncons::ubjson::decode_ubjson)
+
+static void csv_round_trip(benchmark::State& state)
+{
+    const jsoncons::ojson j = jsoncons::ojson::parse(jsoncons_benchmarks::table());
+
+    auto options = jsoncons::csv::csv_options{}
+        .assume_header(true);
+
+    std::string data;
+    jsoncons::csv::encode_csv(j, data, options);
+    document_counters counters(state, data.size());
+    for (auto _ : state)
+    {
+        data.clear();
+        jsoncons::csv::encode_csv(j, data, options);
+        jsoncons::ojson result = jsoncons::csv::decode_csv<jsoncons::ojson>(data, options);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_CAPTURE(cbor_round_trip, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cbor_round_trip, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cbor_round_trip, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(msgpack_round_trip, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(msgpack_round_trip, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(msgpack_round_trip, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(bson_round_trip, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(bson_round_trip, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(bson_round_trip, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ubjson_round_trip, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ubjson_round_trip, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ubjson_round_trip, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(csv_round_trip)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,278 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#ifndef JSONCONS_BENCHMARKS_CORPUS_HPP
+#define JSONCONS_BENCHMARKS_CORPUS_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <jsoncons/json.hpp>
+
+namespace jsoncons_benchmarks {
+
+    // Deterministic generator, so that every run sees the same documents
+    class xorshift
+    {
+        uint64_t state_;
+    public:
+        explicit xorshift(uint64_t seed)
+            : state_(seed)
+        {
+        }
+
+        uint64_t next()
+        {
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 7;
+            state_ ^= state_ << 17;
+            return state_;
+        }
+
+        int64_t uniform(int64_t lo, int64_t hi)
+        {
+            return lo + static_cast<int64_t>(next() % static_cast<uint64_t>(hi - lo + 1));
+        }
+
+        double real(double lo, double hi)
+        {
+            return lo + (hi - lo) * (static_cast<double>(next() >> 11) / 9007199254740992.0);
+        }
+
+        std::string word(std::size_t min_length, std::size_t max_length)
+        {
+            static const char letters[] = "abcdefghijklmnopqrstuvwxyz";
+            std::size_t length = static_cast<std::size_t>(uniform(int64_t(min_length), int64_t(max_length)));
+            std::string s;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                s.push_back(letters[next() % 26]);
+            }
+            return s;
+        }
+    };
+
+    // Reads name from the directory in JSONCONS_BENCHMARK_DATA, if set and the file exists
+    inline
+    bool read_data_file(const char* name, std::string& s)
+    {
+        const char* dir = std::getenv("JSONCONS_BENCHMARK_DATA");
+        if (dir == nullptr)
+        {
+            return false;
+        }
+        std::ifstream is(std::string(dir) + "/" + name, std::ios::binary);
+        if (!is)
+        {
+            return false;
+        }
+        std::ostringstream os;
+        os << is.rdbuf();
+        s = os.str();
+        return true;
+    }
+
+    // GeoJSON polygons, mostly floating point numbers
+    inline
+    std::string make_canada_like()
+    {
+        xorshift rng(1);
+        jsoncons::json rings(jsoncons::json_array_arg);
+        for (int i = 0; i < 60; ++i)
+        {
+            jsoncons::json ring(jsoncons::json_array_arg);
+            ring.reserve(800);
+            for (int j = 0; j < 800; ++j)
+            {
+                jsoncons::json point(jsoncons::json_array_arg);
+                point.push_back(rng.real(-141.0, -52.0));
+                point.push_back(rng.real(41.0, 83.0));
+                ring.push_back(std::move(point));
+            }
+            rings.push_back(std::move(ring));
+        }
+        jsoncons::json geometry;
+        geometry["type"] = "Polygon";
+        geometry["coordinates"] = std::move(rings);
+
+        jsoncons::json feature;
+        feature["type"] = "Feature";
+        feature["properties"]["name"] = "Canada";
+        feature["geometry"] = std::move(geometry);
+
+        jsoncons::json doc;
+        doc["type"] = "FeatureCollection";
+        doc["features"] = jsoncons::json(jsoncons::json_array_arg);
+        doc["features"].push_back(std::move(feature));
+        return doc.to_string();
+    }
+
+    // Status updates, mostly strings, with escapes and non-ASCII text
+    inline
+    std::string make_twitter_like()
+    {
+        xorshift rng(2);
+        jsoncons::ojson statuses(jsoncons::json_array_arg);
+        for (int i = 0; i < 800; ++i)
+        {
+            jsoncons::ojson status;
+            int64_t id = 505874924095815681 + i;
+            status["id"] = id;
+            status["id_str"] = std::to_string(id);
+            std::string text = "@" + rng.word(4, 12) + " ";
+            for (int k = 0; k < 12; ++k)
+            {
+                text += rng.word(1, 9);
+                text += (k % 5 == 4) ? " \"\xe3\x81\x8a\xe3\x81\xaf\xe3\x82\x88\xe3\x81\x86\"\n" : " ";
+            }
+            status["text"] = text;
+            status["source"] = "<a href=\"http://twitter.com/download/iphone\" rel=\"nofollow\">Twitter for iPhone</a>";
+            status["truncated"] = false;
+            status["in_reply_to_status_id"] = jsoncons::null_type();
+
+            jsoncons::ojson user;
+            user["id"] = rng.uniform(1000000, 3000000000);
+            user["name"] = rng.word(3, 10) + " " + rng.word(3, 10);
+            user["screen_name"] = rng.word(5, 15);
+            user["location"] = "\xe6\x9d\xb1\xe4\xba\xac";
+            user["description"] = rng.word(10, 40) + " " + rng.word(10, 40);
+            user["followers_count"] = rng.uniform(0, 100000);
+            user["friends_count"] = rng.uniform(0, 5000);
+            user["verified"] = (i % 17) == 0;
+            status["user"] = std::move(user);
+
+            jsoncons::ojson hashtags(jsoncons::json_array_arg);
+            for (int64_t k = 0, n = rng.uniform(0, 3); k < n; ++k)
+            {
+                jsoncons::ojson tag;
+                tag["text"] = rng.word(3, 12);
+                int64_t start = rng.uniform(0, 100);
+                tag["indices"] = jsoncons::ojson(jsoncons::json_array_arg, {start, start + 8});
+                hashtags.push_back(std::move(tag));
+            }
+            status["entities"]["hashtags"] = std::move(hashtags);
+            status["retweet_count"] = rng.uniform(0, 50);
+            status["favorite_count"] = rng.uniform(0, 50);
+            status["lang"] = (i % 3 == 0) ? "en" : "ja";
+            statuses.push_back(std::move(status));
+        }
+        jsoncons::ojson doc;
+        doc["statuses"] = std::move(statuses);
+        doc["search_metadata"]["completed_in"] = 0.087;
+        doc["search_metadata"]["count"] = 800;
+        return doc.to_string();
+    }
+
+    // Event catalog, mostly small integers and repeated keys
+    inline
+    std::string make_citm_like()
+    {
+        xorshift rng(3);
+        jsoncons::ojson events;
+        for (int i = 0; i < 200; ++i)
+        {
+            int64_t id = 138586341 + i;
+            jsoncons::ojson event;
+            event["description"] = jsoncons::null_type();
+            event["id"] = id;
+            event["logo"] = "/images/UE0AAAAACEKo6QAAAAZDSVRN";
+            event["name"] = rng.word(5, 20);
+            event["subTopicIds"] = jsoncons::ojson(jsoncons::json_array_arg, {337184269, 337184283});
+            event["subjectCode"] = jsoncons::null_type();
+            event["subtitle"] = jsoncons::null_type();
+            event["topicIds"] = jsoncons::ojson(jsoncons::json_array_arg, {324846099, 107888604});
+            events[std::to_string(id)] = std::move(event);
+        }
+        jsoncons::ojson performances(jsoncons::json_array_arg);
+        for (int i = 0; i < 1200; ++i)
+        {
+            jsoncons::ojson performance;
+            performance["eventId"] = 138586341 + rng.uniform(0, 199);
+            performance["id"] = 339887544 + i;
+            performance["logo"] = jsoncons::null_type();
+            performance["name"] = jsoncons::null_type();
+            jsoncons::ojson prices(jsoncons::json_array_arg);
+            jsoncons::ojson seat_categories(jsoncons::json_array_arg);
+            for (int k = 0; k < 3; ++k)
+            {
+                jsoncons::ojson price;
+                price["amount"] = rng.uniform(10, 200) * 500;
+                price["audienceSubCategoryId"] = 337100890;
+                price["seatCategoryId"] = 338937295 + k;
+                prices.push_back(std::move(price));
+
+                jsoncons::ojson area;
+                area["areaId"] = 205705999 + k;
+                area["blockIds"] = jsoncons::ojson(jsoncons::json_array_arg);
+                jsoncons::ojson category;
+                category["areas"] = jsoncons::ojson(jsoncons::json_array_arg);
+                category["areas"].push_back(std::move(area));
+                category["seatCategoryId"] = 338937295 + k;
+                seat_categories.push_back(std::move(category));
+            }
+            performance["prices"] = std::move(prices);
+            performance["seatCategories"] = std::move(seat_categories);
+            performance["seatMapImage"] = jsoncons::null_type();
+            performance["start"] = 1372616400000 + int64_t(i) * 86400000;
+            performance["venueCode"] = "PLEYEL_PLEYEL";
+            performances.push_back(std::move(performance));
+        }
+        jsoncons::ojson doc;
+        doc["events"] = std::move(events);
+        doc["performances"] = std::move(performances);
+        return doc.to_string();
+    }
+
+    // A flat array of records, suitable for CSV
+    inline
+    std::string make_table()
+    {
+        xorshift rng(4);
+        jsoncons::ojson rows(jsoncons::json_array_arg);
+        for (int i = 0; i < 5000; ++i)
+        {
+            jsoncons::ojson row;
+            row["id"] = i;
+            row["name"] = rng.word(4, 16);
+            row["quantity"] = rng.uniform(0, 1000);
+            row["price"] = rng.real(0.0, 500.0);
+            row["active"] = (i % 3) != 0;
+            rows.push_back(std::move(row));
+        }
+        return rows.to_string();
+    }
+
+    inline
+    const std::string& canada()
+    {
+        static const std::string s = []{std::string t; return read_data_file("canada.json", t) ? t : make_canada_like();}();
+        return s;
+    }
+
+    inline
+    const std::string& twitter()
+    {
+        static const std::string s = []{std::string t; return read_data_file("twitter.json", t) ? t : make_twitter_like();}();
+        return s;
+    }
+
+    inline
+    const std::string& citm_catalog()
+    {
+        static const std::string s = []{std::string t; return read_data_file("citm_catalog.json", t) ? t : make_citm_like();}();
+        return s;
+    }
+
+    inline
+    const std::string& table()
+    {
+        static const std::string s = make_table();
+        return s;
+    }
+
+} // namespace jsoncons_benchmarks
+
+#endif // JSONCONS_BENCHMARKS_CORPUS_HPP
@@ -0,0 +1,239 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+
+#include "allocation_counter.hpp"
+#include "corpus.hpp"
+
+namespace ns {
+
+    struct price
+    {
+        int64_t amount{0};
+        int64_t audienceSubCategoryId{0};
+        int64_t seatCategoryId{0};
+    };
+
+    struct area
+    {
+        int64_t areaId{0};
+        std::vector<int64_t> blockIds;
+    };
+
+    struct seat_category
+    {
+        std::vector<area> areas;
+        int64_t seatCategoryId{0};
+    };
+
+    struct performance
+    {
+        int64_t eventId{0};
+        int64_t id{0};
+        std::vector<price> prices;
+        std::vector<seat_category> seatCategories;
+        int64_t start{0};
+        std::string venueCode;
+    };
+
+    struct event
+    {
+        int64_t id{0};
+        std::string name;
+        std::vector<int64_t> subTopicIds;
+        std::vector<int64_t> topicIds;
+    };
+
+    struct catalog
+    {
+        std::map<std::string,event> events;
+        std::vector<performance> performances;
+    };
+
+} // namespace ns
+
+JSONCONS_N_MEMBER_TRAITS(ns::price, 0, amount, audienceSubCategoryId, seatCategoryId)
+JSONCONS_N_MEMBER_TRAITS(ns::area, 0, areaId, blockIds)
+JSONCONS_N_MEMBER_TRAITS(ns::seat_category, 0, areas, seatCategoryId)
+JSONCONS_N_MEMBER_TRAITS(ns::performance, 0, eventId, id, prices, seatCategories, start, venueCode)
+JSONCONS_N_MEMBER_TRAITS(ns::event, 0, id, name, subTopicIds, topicIds)
+JSONCONS_N_MEMBER_TRAITS(ns::catalog, 0, events, performances)
+
+using jsoncons_benchmarks::document_counters;
+
+using corpus_function = const std::string& (*)();
+
+static void json_parse(benchmark::State& state, corpus_function corpus)
+{
+    const std::string& input = corpus();
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        jsoncons::json j = jsoncons::json::parse(input);
+        benchmark::DoNotOptimize(j);
+    }
+}
+
+static void ojson_parse(benchmark::State& state, corpus_function corpus)
+{
+    const std::string& input = corpus();
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        jsoncons::ojson j = jsoncons::ojson::parse(input);
+        benchmark::DoNotOptimize(j);
+    }
+}
+
+static void json_decoder(benchmark::State& state, corpus_function corpus)
+{
+    const std::string& input = corpus();
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        jsoncons::json_decoder<jsoncons::json> decoder;
+        jsoncons::json_string_reader reader(input, decoder);
+        reader.read();
+        jsoncons::json j = decoder.get_result();
+        benchmark::DoNotOptimize(j);
+    }
+}
+
+static void json_cursor(benchmark::State& state, corpus_function corpus)
+{
+    const std::string& input = corpus();
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+        jsoncons::json_string_cursor cursor(input);
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+static void arena_json_decode(benchmark::State& state, corpus_function corpus)
+{
+    const std::string& input = corpus();
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        jsoncons::monotonic_arena arena;
+        jsoncons::arena_json j = jsoncons::decode_json<jsoncons::arena_json>(arena, input);
+        benchmark::DoNotOptimize(j);
+    }
+}
+
+static void decode_json_reflect(benchmark::State& state)
+{
+    const std::string& input = jsoncons_benchmarks::citm_catalog();
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        ns::catalog c = jsoncons::decode_json<ns::catalog>(input);
+        benchmark::DoNotOptimize(c);
+    }
+}
+
+// One status per line, read with the number of threads given by the benchmark argument
+static void json_lines_read(benchmark::State& state)
+{
+    const jsoncons::json doc = jsoncons::json::parse(jsoncons_benchmarks::twitter());
+    std::string input;
+    for (int i = 0; i < 50; ++i)
+    {
+        for (const auto& status : doc.at("statuses").array_range())
+        {
+            status.dump(input);
+            input.push_back('\n');
+        }
+    }
+
+    auto options = jsoncons::json_lines_options{}
+        .thread_count(static_cast<std::size_t>(state.range(0)))
+        .chunk_size(256*1024);
+
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+        jsoncons::json_lines_reader reader(input, options);
+        reader.read<jsoncons::json>([&](jsoncons::json&& j) {benchmark::DoNotOptimize(j); ++count;});
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+static void encode_compact(benchmark::State& state, corpus_function corpus)
+{
+    const jsoncons::json j = jsoncons::json::parse(corpus());
+    std::string output;
+    j.dump(output);
+    const std::size_t size = output.size();
+
+    document_counters counters(state, size);
+    for (auto _ : state)
+    {
+        output.clear();
+        jsoncons::compact_json_string_encoder encoder(output);
+        j.dump(encoder);
+        benchmark::DoNotOptimize(output.data());
+    }
+}
+
+static void encode_pretty(benchmark::State& state, corpus_function corpus)
+{
+    const jsoncons::json j = jsoncons::json::parse(corpus());
+    std::string output;
+    j.dump_pretty(output);
+    const std::size_t size = output.size();
+
+    document_counters counters(state, size);
+    for (auto _ : state)
+    {
+        output.clear();
+        jsoncons::json_string_encoder encoder(output);
+        j.dump(encoder);
+        benchmark::DoNotOptimize(output.data());
+    }
+}
+
+BENCHMARK_CAPTURE(json_parse, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(json_parse, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(json_parse, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ojson_parse, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ojson_parse, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(json_decoder, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(json_decoder, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(json_decoder, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(json_cursor, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(json_cursor, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(json_cursor, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(arena_json_decode, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(arena_json_decode, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(decode_json_reflect)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(json_lines_read)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(encode_compact, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(encode_compact, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(encode_compact, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(encode_pretty, canada, jsoncons_benchmarks::canada)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(encode_pretty, twitter, jsoncons_benchmarks::twitter)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(encode_pretty, citm_catalog, jsoncons_benchmarks::citm_catalog)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,120 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/jmespath/jmespath.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons_ext/jsonschema/jsonschema.hpp>
+
+#include "allocation_counter.hpp"
+#include "corpus.hpp"
+
+using jsoncons_benchmarks::document_counters;
+
+// Throughput is measured against the size of the queried document
+
+static void jsonpath_evaluate(benchmark::State& state, const char* path)
+{
+    const std::string& input = jsoncons_benchmarks::twitter();
+    const jsoncons::json doc = jsoncons::json::parse(input);
+    auto expr = jsoncons::jsonpath::make_expression<jsoncons::json>(path);
+
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        jsoncons::json result = expr.evaluate(doc);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void jsonpath_compile_and_evaluate(benchmark::State& state, const char* path)
+{
+    const std::string& input = jsoncons_benchmarks::twitter();
+    const jsoncons::json doc = jsoncons::json::parse(input);
+
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        jsoncons::json result = jsoncons::jsonpath::json_query(doc, path);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void jmespath_evaluate(benchmark::State& state, const char* expression)
+{
+    const std::string& input = jsoncons_benchmarks::twitter();
+    const jsoncons::json doc = jsoncons::json::parse(input);
+    auto expr = jsoncons::jmespath::make_expression<jsoncons::json>(expression);
+
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        jsoncons::json result = expr.evaluate(doc);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void jsonschema_validate(benchmark::State& state)
+{
+    const std::string& input = jsoncons_benchmarks::twitter();
+    const jsoncons::json doc = jsoncons::json::parse(input);
+
+    jsoncons::json schema = jsoncons::json::parse(R"(
+{
+    "$schema": "https://json-schema.org/draft/2020-12/schema",
+    "type": "object",
+    "required": ["statuses"],
+    "properties": {
+        "statuses": {
+            "type": "array",
+            "items": {"$ref": "#/$defs/status"}
+        }
+    },
+    "$defs": {
+        "status": {
+            "type": "object",
+            "required": ["id", "id_str", "text", "user"],
+            "properties": {
+                "id": {"type": "integer", "minimum": 0},
+                "id_str": {"type": "string", "pattern": "^[0-9]+$"},
+                "text": {"type": "string", "maxLength": 1000},
+                "truncated": {"type": "boolean"},
+                "user": {
+                    "type": "object",
+                    "required": ["id", "screen_name"],
+                    "properties": {
+                        "id": {"type": "integer"},
+                        "screen_name": {"type": "string", "minLength": 1},
+                        "followers_count": {"type": "integer", "minimum": 0}
+                    }
+                },
+                "lang": {"enum": ["en", "ja"]},
+                "retweet_count": {"type": "integer", "minimum": 0}
+            }
+        }
+    }
+}
+    )");
+    auto compiled = jsoncons::jsonschema::make_json_schema(std::move(schema));
+
+    document_counters counters(state, input.size());
+    for (auto _ : state)
+    {
+        bool valid = compiled.is_valid(doc);
+        benchmark::DoNotOptimize(valid);
+    }
+}
+
+BENCHMARK_CAPTURE(jsonpath_evaluate, names, "$.statuses[*].user.screen_name")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(jsonpath_evaluate, descendants, "$..hashtags[*].text")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(jsonpath_evaluate, filter, "$.statuses[?(@.retweet_count > 10 && @.lang == 'en')].id")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(jsonpath_compile_and_evaluate, filter, "$.statuses[?(@.retweet_count > 10 && @.lang == 'en')].id")->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(jmespath_evaluate, names, "statuses[*].user.screen_name")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(jmespath_evaluate, filter, "statuses[?retweet_count > `10` && lang == 'en'].id")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(jmespath_evaluate, functions, "max_by(statuses, &user.followers_count).user.screen_name")->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(jsonschema_validate)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,217 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ARENA_ALLOCATOR_HPP
+#define JSONCONS_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::addressof
+#include <new> // ::operator new
+#include <scoped_allocator> // std::scoped_allocator_adaptor
+#include <type_traits>
+
+#include <jsoncons/config/compiler_support.hpp>
+
+namespace jsoncons {
+
+    // Bump pointer allocation from a list of chunks. Memory is only reclaimed by
+    // release() or the destructor, which free all chunks at once. Not thread safe.
+
+    class monotonic_arena
+    {
+        struct chunk
+        {
+            chunk* next;
+            std::size_t size;
+        };
+
+        static constexpr std::size_t default_initial_size = 4096;
+        static constexpr std::size_t max_chunk_size = std::size_t(1) << 24;
+
+        chunk* chunks_{nullptr};
+        char* current_{nullptr};
+        char* end_{nullptr};
+        char* initial_buffer_{nullptr};
+        std::size_t initial_buffer_size_{0};
+        std::size_t initial_chunk_size_;
+        std::size_t next_chunk_size_;
+        std::size_t capacity_{0};
+    public:
+        explicit monotonic_arena(std::size_t initial_size = default_initial_size) noexcept
+            : initial_chunk_size_(initial_size > 0 ? initial_size : default_initial_size),
+              next_chunk_size_(initial_chunk_size_)
+        {
+        }
+
+        // Allocates from buffer first, which the arena does not own
+        monotonic_arena(void* buffer, std::size_t size, std::size_t initial_size = default_initial_size) noexcept
+            : current_(static_cast<char*>(buffer)), end_(static_cast<char*>(buffer) + size),
+              initial_buffer_(static_cast<char*>(buffer)), initial_buffer_size_(size),
+              initial_chunk_size_(initial_size > 0 ? initial_size : default_initial_size),
+              next_chunk_size_(initial_chunk_size_)
+        {
+        }
+
+        monotonic_arena(const monotonic_arena&) = delete;
+        monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+        ~monotonic_arena() noexcept
+        {
+            free_chunks();
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+        {
+            char* p = align_up(current_, alignment);
+            if (p == nullptr || p > end_ || size > static_cast<std::size_t>(end_ - p))
+            {
+                add_chunk(size + alignment);
+                p = align_up(current_, alignment);
+            }
+            current_ = p + size;
+            return p;
+        }
+
+        // Frees all chunks, and makes the initial buffer, if any, available again
+        void release() noexcept
+        {
+            free_chunks();
+            current_ = initial_buffer_;
+            end_ = initial_buffer_ + initial_buffer_size_;
+            next_chunk_size_ = initial_chunk_size_;
+        }
+
+        // Bytes of memory obtained from the heap
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        static char* align_up(char* p, std::size_t alignment) noexcept
+        {
+            return reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(p) + alignment - 1) & ~uintptr_t(alignment - 1));
+        }
+
+        void add_chunk(std::size_t min_size)
+        {
+            std::size_t size = next_chunk_size_;
+            while (size < min_size + sizeof(chunk))
+            {
+                size *= 2;
+            }
+            chunk* c = static_cast<chunk*>(::operator new(size));
+            c->next = chunks_;
+            c->size = size;
+            chunks_ = c;
+            capacity_ += size;
+            current_ = reinterpret_cast<char*>(c + 1);
+            end_ = reinterpret_cast<char*>(c) + size;
+            if (next_chunk_size_ < max_chunk_size)
+            {
+                next_chunk_size_ *= 2;
+            }
+        }
+
+        void free_chunks() noexcept
+        {
+            while (chunks_ != nullptr)
+            {
+                chunk* next = chunks_->next;
+                ::operator delete(chunks_);
+                chunks_ = next;
+            }
+            capacity_ = 0;
+        }
+    };
+
+    // Allocates from a monotonic_arena, deallocate does nothing. Not default constructible,
+    // every allocator refers to an arena that must outlive the memory allocated from it.
+
+    template <typename T>
+    class arena_allocator
+    {
+        template <typename U>
+        friend class arena_allocator;
+
+        monotonic_arena* arena_;
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = arena_allocator<U>;
+        };
+
+        arena_allocator() = delete;
+
+        arena_allocator(monotonic_arena& arena) noexcept
+            : arena_(std::addressof(arena))
+        {
+        }
+
+        arena_allocator(const arena_allocator& other) noexcept = default;
+
+        template <typename U>
+        arena_allocator(const arena_allocator<U>& other) noexcept
+            : arena_(other.arena_)
+        {
+        }
+
+        arena_allocator& operator=(const arena_allocator& other) noexcept = default;
+
+        T* allocate(std::size_t n)
+        {
+            if (n > std::size_t(-1) / sizeof(T))
+            {
+                JSONCONS_THROW(std::bad_alloc());
+            }
+            return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, std::size_t) noexcept
+        {
+        }
+
+        monotonic_arena& arena() const noexcept
+        {
+            return *arena_;
+        }
+
+        friend bool operator==(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.arena_;
+        }
+
+        friend bool operator!=(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.arena_;
+        }
+    };
+
+    // Allocators whose deallocate does nothing, values allocated with them are
+    // not destroyed node by node.
+
+    template <typename Allocator>
+    struct is_monotonic_allocator : std::false_type {};
+
+    template <typename T>
+    struct is_monotonic_allocator<arena_allocator<T>> : std::true_type {};
+
+    template <typename T>
+    struct is_monotonic_allocator<std::scoped_allocator_adaptor<arena_allocator<T>>> : std::true_type {};
+
+} // namespace jsoncons
+
+#endif // JSONCONS_ARENA_ALLOCATOR_HPP
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include <jsoncons/allocator_set.hpp>
+#include <jsoncons/arena_allocator.hpp>
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/version.hpp>
 #include <jsoncons/conv_error.hpp>
@@ -48,6 +49,7 @@
 #include <jsoncons/utility/bigint.hpp>
 #include <jsoncons/utility/byte_string.hpp>
 #include <jsoncons/utility/heap_string.hpp>
+#include <jsoncons/utility/interned_key.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 #include <jsoncons/utility/unicode_traits.hpp>
 
@@ -291,6 +293,20 @@ namespace jsoncons {
         using member_key = std::basic_string<CharT, CharTraits, Allocator>;
     };
 
+    // Sorted objects whose keys are shared, reference counted strings. json_decoder
+    // hands out one key per distinct name in a document.
+    struct interned_keys_policy 
+    {
+        template <typename KeyT,typename Json>
+        using object = sorted_json_object<KeyT,Json,std::vector>;
+
+        template <typename Json>
+        using array = json_array<Json,std::vector>;
+        
+        template <typename CharT,typename CharTraits,typename Allocator>
+        using member_key = utility::basic_interned_key<CharT, CharTraits, Allocator>;
+    };
+
     template <typename Policy,typename KeyT,typename Json,typename Enable=void>
     struct object_iterator_typedefs
     {
@@ -882,6 +898,11 @@ namespace jsoncons {
 
         void destroy()
         {
+            // Memory from a monotonic allocator is freed all at once with its arena
+            JSONCONS_IF_CONSTEXPR (is_monotonic_allocator<Allocator>::value)
+            {
+                return;
+            }
             switch (storage_kind())
             {
                 case json_storage_kind::long_str:
@@ -1314,6 +1335,10 @@ namespace jsoncons {
             {
                 std::memcpy(static_cast<void*>(this), &other, sizeof(basic_json));
             }
+            else if (other.get_allocator() == alloc)
+            {
+                uninitialized_move(std::move(other));
+            }
             else
             {
                 uninitialized_copy_a(other, alloc);
@@ -5098,6 +5123,8 @@ namespace jsoncons {
     using wjson = basic_json<wchar_t,sorted_policy,std::allocator<char>>;
     using ojson = basic_json<char, order_preserving_policy, std::allocator<char>>;
     using wojson = basic_json<wchar_t, order_preserving_policy, std::allocator<char>>;
+    using arena_json = basic_json<char,sorted_policy,std::scoped_allocator_adaptor<arena_allocator<char>>>;
+    using arena_ojson = basic_json<char,order_preserving_policy,std::scoped_allocator_adaptor<arena_allocator<char>>>;
 
     inline namespace literals {
 
@@ -8,13 +8,16 @@
 #define JSONCONS_DECODE_JSON_HPP
 
 #include <istream> // std::basic_istream
+#include <string>
 #include <tuple>
 #include <type_traits>
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/allocator_set.hpp>
+#include <jsoncons/arena_allocator.hpp>
 #include <jsoncons/conv_error.hpp>
 #include <jsoncons/json_cursor.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <jsoncons/basic_json.hpp>
 #include <jsoncons/source.hpp>
 #include <jsoncons/ser_util.hpp>
@@ -153,6 +156,47 @@ try_decode_json(InputIt first, InputIt last,
     return reflect::decode_traits<T>::try_decode(make_alloc_set(), cursor);
 }
 
+template <typename T>
+typename std::enable_if<ext_traits::is_basic_json<T>::value,read_result<T>>::type
+try_decode_json(file_path_arg_t, const std::string& path,
+    const basic_json_decode_options<typename T::char_type>& options = basic_json_decode_options<typename T::char_type>())
+{
+    using value_type = T;
+    using result_type = read_result<value_type>;
+    using char_type = typename T::char_type;
+
+    std::error_code ec;   
+    jsoncons::json_decoder<T> decoder;
+    basic_json_reader<char_type, mmap_source<char_type>> reader(mmap_source<char_type>(path), decoder, options);
+    reader.read(ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return result_type{jsoncons::unexpect, ec, reader.line(), reader.column()};
+    }
+    if (JSONCONS_UNLIKELY(!decoder.is_valid()))
+    {
+        return result_type(jsoncons::unexpect, conv_errc::conversion_failed, reader.line(), reader.column());
+    }
+    return result_type{decoder.get_result()};
+}
+
+template <typename T>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value,read_result<T>>::type
+try_decode_json(file_path_arg_t, const std::string& path,
+    const basic_json_decode_options<char>& options = basic_json_decode_options<char>())
+{
+    using value_type = T;
+    using result_type = read_result<value_type>;
+
+    std::error_code ec;
+    basic_json_cursor<char,mmap_source<char>> cursor(mmap_source<char>(path), options, default_json_parsing(), ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
+    }
+    return reflect::decode_traits<T>::try_decode(make_alloc_set(), cursor);
+}
+
 // With leading allocator_set parameter
 
 template <typename T,typename CharsLike,typename Alloc,typename TempAlloc >
@@ -248,6 +292,59 @@ try_decode_json(const allocator_set<Alloc,TempAlloc>& aset,
     return reflect::decode_traits<value_type>::try_decode(aset, cursor);
 }
 
+template <typename T,typename Alloc,typename TempAlloc>
+typename std::enable_if<ext_traits::is_basic_json<T>::value,read_result<T>>::type
+try_decode_json(const allocator_set<Alloc,TempAlloc>& aset,
+    file_path_arg_t, const std::string& path,
+    const basic_json_decode_options<typename T::char_type>& options = basic_json_decode_options<typename T::char_type>())
+{
+    using value_type = T;
+    using result_type = read_result<value_type>;
+    using char_type = typename T::char_type;
+
+    json_decoder<T,TempAlloc> decoder(aset.get_allocator(), aset.get_temp_allocator());
+
+    std::error_code ec;   
+    basic_json_reader<char_type, mmap_source<char_type>,TempAlloc> reader(mmap_source<char_type>(path), decoder, options, aset.get_temp_allocator());
+    reader.read(ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return result_type{jsoncons::unexpect, ec, reader.line(), reader.column()};
+    }
+    if (JSONCONS_UNLIKELY(!decoder.is_valid()))
+    {
+        return result_type(jsoncons::unexpect, conv_errc::conversion_failed, reader.line(), reader.column());
+    }
+    return result_type{decoder.get_result()};
+}
+
+template <typename T,typename Alloc,typename TempAlloc>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value,read_result<T>>::type
+try_decode_json(const allocator_set<Alloc,TempAlloc>& aset,
+    file_path_arg_t, const std::string& path,
+    const basic_json_decode_options<char>& options = basic_json_decode_options<char>())
+{
+    using value_type = T;
+    using result_type = read_result<value_type>;
+
+    std::error_code ec;   
+    basic_json_cursor<char,mmap_source<char>,TempAlloc> cursor(
+        std::allocator_arg, aset.get_temp_allocator(), mmap_source<char>(path), options, ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
+    }
+    return reflect::decode_traits<value_type>::try_decode(aset, cursor);
+}
+
+// With leading monotonic_arena parameter, the result is allocated from the arena
+
+template <typename T, typename... Args>
+read_result<T> try_decode_json(monotonic_arena& arena, Args&& ... args)
+{
+    return try_decode_json<T>(make_alloc_set(arena_allocator<char>(arena)), std::forward<Args>(args)...);
+}
+
 template <typename T, typename... Args>
 T decode_json(Args&& ... args)
 {
@@ -0,0 +1,322 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_STRING_SCAN_HPP
+#define JSONCONS_DETAIL_STRING_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+
+#include <jsoncons/config/compiler_support.hpp>
+
+// Instruction set used for scanning string text, selected at compile time.
+// Define JSONCONS_NO_SIMD to force the portable (SWAR) implementation.
+
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__AVX2__)
+#    define JSONCONS_SIMD_AVX2 1
+#    include <immintrin.h>
+#  elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_SIMD_SSE2 1
+#    include <emmintrin.h>
+#  elif (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)) && (defined(__aarch64__) || defined(_M_ARM64))
+#    define JSONCONS_SIMD_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
+namespace jsoncons {
+namespace detail {
+
+#if defined(__GNUC__) || defined(__clang__)
+    JSONCONS_FORCE_INLINE
+    int count_trailing_zeros(uint32_t x) noexcept
+    {
+        return __builtin_ctz(x);
+    }
+#else
+    JSONCONS_FORCE_INLINE
+    int count_trailing_zeros(uint32_t x) noexcept
+    {
+        int n = 0;
+        while ((x & 1u) == 0)
+        {
+            x >>= 1;
+            ++n;
+        }
+        return n;
+    }
+#endif
+
+    // Returns true if any byte of x is less than 0x20, or is a quotation mark or reverse solidus.
+    JSONCONS_FORCE_INLINE
+    bool has_string_special_byte(uint64_t x) noexcept
+    {
+        constexpr uint64_t ones = 0x0101010101010101ull;
+        constexpr uint64_t highs = 0x8080808080808080ull;
+
+        uint64_t quote = x ^ (ones * '\"');
+        uint64_t backslash = x ^ (ones * '\\');
+        uint64_t lt = (x - ones * 0x20) & ~x;
+        uint64_t eq_quote = (quote - ones) & ~quote;
+        uint64_t eq_backslash = (backslash - ones) & ~backslash;
+        return ((lt | eq_quote | eq_backslash) & highs) != 0;
+    }
+
+    // Advances over string text that can be copied as is, that is, up to the first
+    // quotation mark, reverse solidus or control character (a byte less than 0x20),
+    // or last. Sets non_ascii to true if a byte with the high bit set was scanned;
+    // it is never reset to false.
+
+    inline
+    const char* skip_string_text(const char* first, const char* last, bool& non_ascii) noexcept
+    {
+        const char* p = first;
+
+#if defined(JSONCONS_SIMD_AVX2)
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i ctrl_max = _mm256_set1_epi8(0x1f);
+        while (last - p >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            __m256i special = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                _mm256_cmpeq_epi8(_mm256_max_epu8(v, ctrl_max), ctrl_max));
+            if (_mm256_movemask_epi8(v) != 0)
+            {
+                non_ascii = true;
+            }
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+            if (mask != 0)
+            {
+                return p + count_trailing_zeros(mask);
+            }
+            p += 32;
+        }
+#endif
+#if defined(JSONCONS_SIMD_AVX2) || defined(JSONCONS_SIMD_SSE2)
+        {
+            const __m128i quote = _mm_set1_epi8('\"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i ctrl_max = _mm_set1_epi8(0x1f);
+            while (last - p >= 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i special = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                    _mm_cmpeq_epi8(_mm_max_epu8(v, ctrl_max), ctrl_max));
+                if (_mm_movemask_epi8(v) != 0)
+                {
+                    non_ascii = true;
+                }
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 16;
+            }
+        }
+#elif defined(JSONCONS_SIMD_NEON)
+        {
+            const uint8x16_t quote = vdupq_n_u8('\"');
+            const uint8x16_t backslash = vdupq_n_u8('\\');
+            const uint8x16_t ctrl_end = vdupq_n_u8(0x20);
+            while (last - p >= 16)
+            {
+                uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+                uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)),
+                                              vcltq_u8(v, ctrl_end));
+                if (vmaxvq_u8(v) >= 0x80)
+                {
+                    non_ascii = true;
+                }
+                if (vmaxvq_u8(special) != 0)
+                {
+                    break; // locate the byte below
+                }
+                p += 16;
+            }
+        }
+#endif
+        while (last - p >= 8)
+        {
+            uint64_t x;
+            std::memcpy(&x, p, sizeof(x));
+            if ((x & 0x8080808080808080ull) != 0)
+            {
+                non_ascii = true;
+            }
+            if (has_string_special_byte(x))
+            {
+                break; // locate the byte below
+            }
+            p += 8;
+        }
+        for (; p < last; ++p)
+        {
+            uint8_t c = static_cast<uint8_t>(*p);
+            if (c < 0x20 || c == '\"' || c == '\\')
+            {
+                break;
+            }
+            if (c >= 0x80)
+            {
+                non_ascii = true;
+            }
+        }
+        return p;
+    }
+
+    // Wide character text is not scanned in bulk, callers fall back to examining
+    // each character, and must always validate the text.
+    template <typename CharT>
+    const CharT* skip_string_text(const CharT* first, const CharT*, bool& non_ascii) noexcept
+    {
+        non_ascii = true;
+        return first;
+    }
+
+    // Returns true if any byte of x equals the corresponding byte of ones * c
+    JSONCONS_FORCE_INLINE
+    bool has_byte(uint64_t x, uint8_t c) noexcept
+    {
+        constexpr uint64_t ones = 0x0101010101010101ull;
+        constexpr uint64_t highs = 0x8080808080808080ull;
+
+        uint64_t y = x ^ (ones * c);
+        return ((y - ones) & ~y & highs) != 0;
+    }
+
+    // Advances over string text that a JSON encoder can copy as is, that is, up to the
+    // first quotation mark, reverse solidus, control character (a byte less than 0x20
+    // or 0x7f), solidus if escape_solidus is true, or byte with the high bit set if
+    // escape_all_non_ascii is true, or last.
+
+    inline
+    const char* skip_unescaped_text(const char* first, const char* last,
+                                    bool escape_solidus, bool escape_all_non_ascii) noexcept
+    {
+        const char* p = first;
+        // when solidus is not escaped, compare against the quotation mark a second time
+        const char solidus = escape_solidus ? '/' : '\"';
+
+#if defined(JSONCONS_SIMD_AVX2)
+        {
+            const __m256i quote = _mm256_set1_epi8('\"');
+            const __m256i backslash = _mm256_set1_epi8('\\');
+            const __m256i slash = _mm256_set1_epi8(solidus);
+            const __m256i del = _mm256_set1_epi8(0x7f);
+            const __m256i ctrl_max = _mm256_set1_epi8(0x1f);
+            while (last - p >= 32)
+            {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                __m256i special = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                    _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, slash), _mm256_cmpeq_epi8(v, del)),
+                                    _mm256_cmpeq_epi8(_mm256_max_epu8(v, ctrl_max), ctrl_max)));
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+                if (escape_all_non_ascii)
+                {
+                    mask |= static_cast<uint32_t>(_mm256_movemask_epi8(v));
+                }
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 32;
+            }
+        }
+#endif
+#if defined(JSONCONS_SIMD_AVX2) || defined(JSONCONS_SIMD_SSE2)
+        {
+            const __m128i quote = _mm_set1_epi8('\"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i slash = _mm_set1_epi8(solidus);
+            const __m128i del = _mm_set1_epi8(0x7f);
+            const __m128i ctrl_max = _mm_set1_epi8(0x1f);
+            while (last - p >= 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i special = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                    _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, slash), _mm_cmpeq_epi8(v, del)),
+                                 _mm_cmpeq_epi8(_mm_max_epu8(v, ctrl_max), ctrl_max)));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+                if (escape_all_non_ascii)
+                {
+                    mask |= static_cast<uint32_t>(_mm_movemask_epi8(v));
+                }
+                if (mask != 0)
+                {
+                    return p + count_trailing_zeros(mask);
+                }
+                p += 16;
+            }
+        }
+#elif defined(JSONCONS_SIMD_NEON)
+        {
+            const uint8x16_t quote = vdupq_n_u8('\"');
+            const uint8x16_t backslash = vdupq_n_u8('\\');
+            const uint8x16_t slash = vdupq_n_u8(static_cast<uint8_t>(solidus));
+            const uint8x16_t del = vdupq_n_u8(0x7f);
+            const uint8x16_t ctrl_end = vdupq_n_u8(0x20);
+            const uint8x16_t high_start = vdupq_n_u8(0x80);
+            while (last - p >= 16)
+            {
+                uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+                uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)),
+                                              vorrq_u8(vorrq_u8(vceqq_u8(v, slash), vceqq_u8(v, del)),
+                                                       vcltq_u8(v, ctrl_end)));
+                if (escape_all_non_ascii)
+                {
+                    special = vorrq_u8(special, vcgeq_u8(v, high_start));
+                }
+                if (vmaxvq_u8(special) != 0)
+                {
+                    break; // locate the byte below
+                }
+                p += 16;
+            }
+        }
+#endif
+        const uint64_t high_mask = escape_all_non_ascii ? 0x8080808080808080ull : 0;
+        while (last - p >= 8)
+        {
+            uint64_t x;
+            std::memcpy(&x, p, sizeof(x));
+            if ((x & high_mask) != 0 || has_string_special_byte(x) || has_byte(x, 0x7f) ||
+                has_byte(x, static_cast<uint8_t>(solidus)))
+            {
+                break; // locate the byte below
+            }
+            p += 8;
+        }
+        for (; p < last; ++p)
+        {
+            uint8_t c = static_cast<uint8_t>(*p);
+            if (c < 0x20 || c == '\"' || c == '\\' || c == 0x7f || c == static_cast<uint8_t>(solidus) ||
+                (escape_all_non_ascii && c >= 0x80))
+            {
+                break;
+            }
+        }
+        return p;
+    }
+
+    // Wide character text is not scanned in bulk
+    template <typename CharT>
+    const CharT* skip_unescaped_text(const CharT* first, const CharT*, bool, bool) noexcept
+    {
+        return first;
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_STRING_SCAN_HPP
@@ -0,0 +1,250 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+#define JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits> // std::numeric_limits
+#include <memory> // std::allocator
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/string_scan.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+#if defined(__GNUC__) || defined(__clang__)
+    JSONCONS_FORCE_INLINE
+    int count_trailing_zeros(uint64_t x) noexcept
+    {
+        return __builtin_ctzll(x);
+    }
+#else
+    JSONCONS_FORCE_INLINE
+    int count_trailing_zeros(uint64_t x) noexcept
+    {
+        int n = 0;
+        while ((x & 1u) == 0)
+        {
+            x >>= 1;
+            ++n;
+        }
+        return n;
+    }
+#endif
+
+    // Character class bitmaps for a 64 character block, bit i corresponds to character i
+
+    struct structural_block
+    {
+        uint64_t quote{0};
+        uint64_t backslash{0};
+        uint64_t op{0};         // { } [ ] : ,
+        uint64_t whitespace{0}; // space, tab, line feed, carriage return
+    };
+
+    template <typename CharT>
+    void classify_block(const CharT* p, structural_block& block) noexcept
+    {
+        for (std::size_t i = 0; i < 64; ++i)
+        {
+            const uint64_t bit = uint64_t(1) << i;
+            switch (p[i])
+            {
+                case '\"':
+                    block.quote |= bit;
+                    break;
+                case '\\':
+                    block.backslash |= bit;
+                    break;
+                case '{': case '}': case '[': case ']': case ':': case ',':
+                    block.op |= bit;
+                    break;
+                case ' ': case '\t': case '\n': case '\r':
+                    block.whitespace |= bit;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+#if defined(JSONCONS_SIMD_AVX2) || defined(JSONCONS_SIMD_SSE2)
+    JSONCONS_FORCE_INLINE
+    uint64_t movemask64(__m128i v, int shift) noexcept
+    {
+        return uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(v))) << shift;
+    }
+
+    inline
+    void classify_block(const char* p, structural_block& block) noexcept
+    {
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i colon = _mm_set1_epi8(':');
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i lbracket = _mm_set1_epi8('[');
+        const __m128i rbracket = _mm_set1_epi8(']');
+        const __m128i lbrace = _mm_set1_epi8('{');
+        const __m128i rbrace = _mm_set1_epi8('}');
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i lf = _mm_set1_epi8('\n');
+        const __m128i cr = _mm_set1_epi8('\r');
+
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+            const int shift = 16*i;
+            block.quote |= movemask64(_mm_cmpeq_epi8(v, quote), shift);
+            block.backslash |= movemask64(_mm_cmpeq_epi8(v, backslash), shift);
+            __m128i op = _mm_or_si128(
+                _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, colon), _mm_cmpeq_epi8(v, comma)),
+                             _mm_or_si128(_mm_cmpeq_epi8(v, lbracket), _mm_cmpeq_epi8(v, rbracket))),
+                _mm_or_si128(_mm_cmpeq_epi8(v, lbrace), _mm_cmpeq_epi8(v, rbrace)));
+            block.op |= movemask64(op, shift);
+            __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+                                      _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr)));
+            block.whitespace |= movemask64(ws, shift);
+        }
+    }
+#endif
+
+    JSONCONS_FORCE_INLINE
+    uint64_t prefix_xor(uint64_t x) noexcept
+    {
+        x ^= x << 1;
+        x ^= x << 2;
+        x ^= x << 4;
+        x ^= x << 8;
+        x ^= x << 16;
+        x ^= x << 32;
+        return x;
+    }
+
+    // Stage 1 of two stage parsing: records the offsets of the structural characters in a
+    // buffer of JSON text. These are the operators { } [ ] : , outside of strings, the
+    // opening quotes of strings, and the first characters of numbers and literals
+    // (and of anything else that is neither whitespace nor inside a string.)
+
+    template <typename CharT, typename Allocator = std::allocator<uint32_t>>
+    class basic_structural_index
+    {
+        std::vector<uint32_t,Allocator> offsets_;
+
+        // state carried from one block to the next
+        uint64_t prev_escaped_{0};
+        uint64_t prev_in_string_{0};
+        uint64_t prev_scalar_{0};
+    public:
+        using allocator_type = Allocator;
+
+        basic_structural_index(const Allocator& alloc = Allocator())
+            : offsets_(alloc)
+        {
+        }
+
+        std::size_t size() const
+        {
+            return offsets_.size();
+        }
+
+        bool empty() const
+        {
+            return offsets_.empty();
+        }
+
+        uint32_t operator[](std::size_t i) const
+        {
+            return offsets_[i];
+        }
+
+        void clear()
+        {
+            offsets_.clear();
+        }
+
+        // Indexes the text [data, data+length), which must start outside of a string.
+        // Returns false if the text is too long to be indexed.
+        bool build(const CharT* data, std::size_t length)
+        {
+            offsets_.clear();
+            prev_escaped_ = 0;
+            prev_in_string_ = 0;
+            prev_scalar_ = 0;
+            if (length > (std::numeric_limits<uint32_t>::max)())
+            {
+                return false;
+            }
+            offsets_.reserve(length/8 + 8);
+
+            std::size_t pos = 0;
+            for (; pos + 64 <= length; pos += 64)
+            {
+                structural_block block;
+                classify_block(data + pos, block);
+                add_block(block, pos);
+            }
+            if (pos < length)
+            {
+                CharT tail[64];
+                std::size_t n = length - pos;
+                for (std::size_t i = 0; i < 64; ++i)
+                {
+                    tail[i] = i < n ? data[pos + i] : CharT(' ');
+                }
+                structural_block block;
+                classify_block(static_cast<const CharT*>(tail), block);
+                add_block(block, pos);
+            }
+            return true;
+        }
+    private:
+        // Characters escaped by an odd length sequence of backslashes
+        uint64_t find_escaped(uint64_t backslash)
+        {
+            constexpr uint64_t even_bits = 0x5555555555555555ull;
+
+            backslash &= ~prev_escaped_;
+            uint64_t follows_escape = (backslash << 1) | prev_escaped_;
+            uint64_t odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+            uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+            prev_escaped_ = sequences_starting_on_even_bits < odd_sequence_starts ? 1 : 0;
+            uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+            return (even_bits ^ invert_mask) & follows_escape;
+        }
+
+        void add_block(const structural_block& block, std::size_t base)
+        {
+            uint64_t escaped = find_escaped(block.backslash);
+            uint64_t quote = block.quote & ~escaped;
+
+            // in_string includes the opening quote but not the closing one
+            uint64_t in_string = prefix_xor(quote) ^ prev_in_string_;
+            prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+            uint64_t string_tail = in_string ^ quote;
+
+            uint64_t scalar = ~(block.op | block.whitespace);
+            uint64_t nonquote_scalar = scalar & ~quote;
+            uint64_t follows_nonquote_scalar = (nonquote_scalar << 1) | prev_scalar_;
+            prev_scalar_ = nonquote_scalar >> 63;
+
+            uint64_t structurals = (block.op | (scalar & ~follows_nonquote_scalar)) & ~string_tail;
+            while (structurals != 0)
+            {
+                offsets_.push_back(static_cast<uint32_t>(base + count_trailing_zeros(structurals)));
+                structurals &= structurals - 1;
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
@@ -0,0 +1,127 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_WRITE_DIGITS_HPP
+#define JSONCONS_DETAIL_WRITE_DIGITS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <jsoncons/config/compiler_support.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h> // _BitScanReverse64
+#endif
+
+namespace jsoncons {
+namespace detail {
+
+    // Number of significant bits in x | 1
+    JSONCONS_FORCE_INLINE
+    int bit_width_or_one(uint64_t x) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 64 - __builtin_clzll(x | 1);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long index;
+        _BitScanReverse64(&index, x | 1);
+        return static_cast<int>(index) + 1;
+#else
+        int n = 1;
+        while ((x >>= 1) != 0)
+        {
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    inline
+    const uint64_t* powers_of_ten_64()
+    {
+        static const uint64_t table[] = {
+            1ull,
+            10ull,
+            100ull,
+            1000ull,
+            10000ull,
+            100000ull,
+            1000000ull,
+            10000000ull,
+            100000000ull,
+            1000000000ull,
+            10000000000ull,
+            100000000000ull,
+            1000000000000ull,
+            10000000000000ull,
+            100000000000000ull,
+            1000000000000000ull,
+            10000000000000000ull,
+            100000000000000000ull,
+            1000000000000000000ull,
+            10000000000000000000ull
+        };
+        return table;
+    }
+
+    // Number of decimal digits in n, 1 for 0
+    JSONCONS_FORCE_INLINE
+    int count_digits(uint64_t n) noexcept
+    {
+        // t approximates log10(2^width), the number of digits is t or t+1
+        const int t = (bit_width_or_one(n) * 1233) >> 12;
+        return t + ((n | 1) >= powers_of_ten_64()[t] ? 1 : 0);
+    }
+
+    inline
+    const char* digit_pairs()
+    {
+        static const char table[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+        return table;
+    }
+
+    // Writes the decimal digits of n to buffer, two at a time from the end,
+    // returns the number of digits. buffer must have room for 20 characters.
+    inline
+    std::size_t write_digits(uint64_t n, char* buffer) noexcept
+    {
+        const char* pairs = digit_pairs();
+        const std::size_t length = static_cast<std::size_t>(count_digits(n));
+        char* p = buffer + length;
+        while (n >= 100)
+        {
+            const char* d = pairs + 2*(n % 100);
+            n /= 100;
+            *--p = d[1];
+            *--p = d[0];
+        }
+        if (n >= 10)
+        {
+            const char* d = pairs + 2*n;
+            *--p = d[1];
+            *--p = d[0];
+        }
+        else
+        {
+            *--p = static_cast<char>('0' + n);
+        }
+        return length;
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_WRITE_DIGITS_HPP
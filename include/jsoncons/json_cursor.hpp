@@ -21,6 +21,7 @@
 #include <jsoncons/json_parser.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/ser_util.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <jsoncons/source.hpp>
 #include <jsoncons/source_adaptor.hpp>
 #include <jsoncons/staj_cursor.hpp>
@@ -513,6 +514,7 @@ using json_stream_cursor = basic_json_cursor<char,jsoncons::stream_source<char>>
 using json_string_cursor = basic_json_cursor<char,jsoncons::string_source<char>>;
 using wjson_stream_cursor = basic_json_cursor<wchar_t,jsoncons::stream_source<wchar_t>>;
 using wjson_string_cursor = basic_json_cursor<wchar_t,jsoncons::string_source<wchar_t>>;
+using json_file_cursor = basic_json_cursor<char,jsoncons::mmap_source<char>>;
 
 } // namespace jsoncons
 
@@ -19,6 +19,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/semantic_tag.hpp>
 #include <jsoncons/ser_util.hpp>
+#include <jsoncons/utility/interned_key.hpp>
 
 namespace jsoncons {
 
@@ -64,6 +65,7 @@ private:
 
     std::size_t index_{0};
     key_type name_;
+    utility::key_pool_t<key_type> key_pool_;
     std::vector<index_key_value<Json>,stack_item_allocator_type> item_stack_;
     std::vector<structure_info,structure_info_allocator_type> structure_stack_;
     bool is_valid_{false};
@@ -74,6 +76,7 @@ public:
         : allocator_(alloc),
           result_(),
           name_(alloc),
+          key_pool_(alloc),
           item_stack_(alloc),
           structure_stack_(temp_alloc)
     {
@@ -87,6 +90,7 @@ public:
         : allocator_(),
           result_(),
           name_(),
+          key_pool_(),
           item_stack_(),
           structure_stack_(temp_alloc)
     {
@@ -212,7 +216,7 @@ private:
 
     JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
-        name_ = key_type(name.data(),name.length(),allocator_);
+        name_ = key_pool_.get(name.data(),name.length());
         JSONCONS_VISITOR_RETURN;
     }
 
@@ -19,6 +19,7 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/string_scan.hpp>
 #include <jsoncons/utility/write_number.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/json_exception.hpp>
@@ -57,6 +58,18 @@ namespace detail {
         const CharT* end = s + length;
         for (const CharT* it = begin; it != end; ++it)
         {
+            // copy text that needs no escaping in bulk
+            const CharT* next = skip_unescaped_text(it, end, escape_solidus, escape_all_non_ascii);
+            if (next != it)
+            {
+                sink.append(it, static_cast<std::size_t>(next - it));
+                count += static_cast<std::size_t>(next - it);
+                it = next;
+                if (it == end)
+                {
+                    break;
+                }
+            }
             CharT c = *it;
             switch (c)
             {
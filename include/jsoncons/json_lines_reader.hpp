@@ -0,0 +1,459 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_LINES_READER_HPP
+#define JSONCONS_JSON_LINES_READER_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/mmap_source.hpp>
+#include <jsoncons/utility/unicode_traits.hpp>
+
+namespace jsoncons {
+
+    class json_lines_options
+    {
+        std::size_t thread_count_{0};
+        std::size_t chunk_size_{1024*1024};
+        std::size_t max_chunks_in_flight_{0};
+        bool ordered_{true};
+    public:
+        json_lines_options() = default;
+
+        json_lines_options(const json_lines_options& other) = default;
+
+        json_lines_options& operator=(const json_lines_options& other) = default;
+
+        // Number of worker threads, 0 means std::thread::hardware_concurrency()
+        std::size_t thread_count() const
+        {
+            return thread_count_;
+        }
+        json_lines_options& thread_count(std::size_t value)
+        {
+            thread_count_ = value;
+            return *this;
+        }
+
+        // Approximate number of characters in a chunk, a chunk always ends at a newline
+        std::size_t chunk_size() const
+        {
+            return chunk_size_;
+        }
+        json_lines_options& chunk_size(std::size_t value)
+        {
+            chunk_size_ = value == 0 ? 1 : value;
+            return *this;
+        }
+
+        // Bound on chunks that have been claimed by a worker but not yet delivered,
+        // 0 means twice the number of threads
+        std::size_t max_chunks_in_flight() const
+        {
+            return max_chunks_in_flight_;
+        }
+        json_lines_options& max_chunks_in_flight(std::size_t value)
+        {
+            max_chunks_in_flight_ = value;
+            return *this;
+        }
+
+        // Deliver values in input order, otherwise chunk by chunk as they complete
+        bool ordered() const
+        {
+            return ordered_;
+        }
+        json_lines_options& ordered(bool value)
+        {
+            ordered_ = value;
+            return *this;
+        }
+    };
+
+    template <typename CharT>
+    class basic_json_lines_reader
+    {
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+    private:
+        template <typename Json>
+        struct chunk_result
+        {
+            std::vector<Json> values;
+            std::size_t lines{0};
+            std::error_code ec;
+            std::size_t error_line{0};
+            std::size_t error_column{0};
+            std::exception_ptr exception;
+        };
+
+        template <typename Json>
+        struct shared_state
+        {
+            std::mutex mutex;
+            std::condition_variable ready_cv;
+            std::condition_variable space_cv;
+            const CharT* next;
+            const CharT* last;
+            std::size_t claimed{0};
+            std::size_t delivered{0};
+            std::size_t active_workers{0};
+            bool stop{false};
+            std::vector<std::size_t> line_counts;
+            std::map<std::size_t,chunk_result<Json>> ready;
+
+            shared_state(const CharT* first, const CharT* last)
+                : next(first), last(last)
+            {
+            }
+        };
+
+        detail::mapped_file file_;
+        std::basic_string<CharT> buffer_;
+        const CharT* data_{nullptr};
+        std::size_t length_{0};
+        json_lines_options options_;
+        basic_json_decode_options<CharT> decode_options_;
+        std::size_t line_{0};
+        std::size_t column_{0};
+    public:
+        // Reads input, which must outlive the reader
+        basic_json_lines_reader(const string_view_type& input,
+            const json_lines_options& options = json_lines_options(),
+            const basic_json_decode_options<CharT>& decode_options = basic_json_decode_options<CharT>())
+            : data_(input.data()), length_(input.size()), options_(options), decode_options_(decode_options)
+        {
+            skip_bom();
+        }
+
+        // Reads the file at path, memory mapped where the platform supports it
+        basic_json_lines_reader(file_path_arg_t, const std::string& path,
+            const json_lines_options& options = json_lines_options(),
+            const basic_json_decode_options<CharT>& decode_options = basic_json_decode_options<CharT>())
+            : file_(path.c_str()), options_(options), decode_options_(decode_options)
+        {
+            static_assert(sizeof(CharT) == 1, "Reading a file requires a single byte character type");
+            if (file_.is_error())
+            {
+                JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to open " + path));
+            }
+            if (file_.is_mapped())
+            {
+                data_ = reinterpret_cast<const CharT*>(file_.data());
+                length_ = file_.size();
+            }
+            else
+            {
+                CharT buf[16384];
+                std::size_t count;
+                while ((count = file_.read(buf, sizeof(buf))) > 0)
+                {
+                    buffer_.append(buf, count);
+                }
+                if (file_.is_error())
+                {
+                    JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to read " + path));
+                }
+                data_ = buffer_.data();
+                length_ = buffer_.size();
+            }
+            skip_bom();
+        }
+
+        basic_json_lines_reader(const basic_json_lines_reader&) = delete;
+        basic_json_lines_reader& operator=(const basic_json_lines_reader&) = delete;
+
+        // Calls callback(Json&&) on the calling thread for each value
+        template <typename Json,typename Callback>
+        void read(Callback callback)
+        {
+            std::error_code ec;
+            read<Json>(callback, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                JSONCONS_THROW(ser_error(ec, line_, column_));
+            }
+        }
+
+        template <typename Json,typename Callback>
+        void read(Callback callback, std::error_code& ec)
+        {
+            line_ = 0;
+            column_ = 0;
+
+            std::size_t thread_count = options_.thread_count();
+            if (thread_count == 0)
+            {
+                thread_count = (std::max)(std::thread::hardware_concurrency(), 1u);
+            }
+            const std::size_t max_in_flight = options_.max_chunks_in_flight() != 0 ? options_.max_chunks_in_flight() : 2*thread_count;
+
+            shared_state<Json> state(data_, data_ + length_);
+            state.active_workers = thread_count;
+
+            std::vector<std::thread> workers;
+            workers.reserve(thread_count);
+            auto stop_and_join = [&]()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    state.stop = true;
+                }
+                state.space_cv.notify_all();
+                for (auto& t : workers)
+                {
+                    if (t.joinable())
+                    {
+                        t.join();
+                    }
+                }
+            };
+
+            JSONCONS_TRY
+            {
+                for (std::size_t i = 0; i < thread_count; ++i)
+                {
+                    workers.emplace_back([this,&state,max_in_flight]() {work(state, max_in_flight);});
+                }
+                consume(state, callback, ec);
+            }
+            JSONCONS_CATCH(...)
+            {
+                stop_and_join();
+                JSONCONS_RETHROW;
+            }
+            stop_and_join();
+        }
+
+        // Line and column of the error after a failed read
+        std::size_t line() const
+        {
+            return line_;
+        }
+
+        std::size_t column() const
+        {
+            return column_;
+        }
+
+    private:
+        void skip_bom()
+        {
+            auto r = unicode_traits::detect_encoding_from_bom(data_, length_);
+            std::size_t offset = r.ptr - data_;
+            data_ += offset;
+            length_ -= offset;
+        }
+
+        const CharT* chunk_end(const CharT* first, const CharT* last) const
+        {
+            if (static_cast<std::size_t>(last - first) <= options_.chunk_size())
+            {
+                return last;
+            }
+            const CharT* p = std::find(first + options_.chunk_size(), last, '\n');
+            return p == last ? last : p + 1;
+        }
+
+        static bool is_blank(const CharT* first, const CharT* last)
+        {
+            for (; first != last; ++first)
+            {
+                if (!(*first == ' ' || *first == '\t' || *first == '\r'))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename Json>
+        void work(shared_state<Json>& state, std::size_t max_in_flight)
+        {
+            basic_json_parser<CharT> parser(decode_options_);
+            json_decoder<Json> decoder;
+
+            while (true)
+            {
+                std::size_t id;
+                const CharT* first;
+                const CharT* last;
+                {
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    state.space_cv.wait(lock, [&]() {return state.stop || state.next == state.last || state.claimed - state.delivered < max_in_flight;});
+                    if (state.stop || state.next == state.last)
+                    {
+                        break;
+                    }
+                    id = state.claimed++;
+                    first = state.next;
+                    last = chunk_end(first, state.last);
+                    state.next = last;
+                    state.line_counts.push_back(0);
+                }
+
+                chunk_result<Json> result;
+                JSONCONS_TRY
+                {
+                    parse_chunk(first, last, parser, decoder, result);
+                }
+                JSONCONS_CATCH(...)
+                {
+                    result.exception = std::current_exception();
+                    parser.reset();
+                    decoder.reset();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    state.line_counts[id] = result.lines;
+                    if (result.ec || result.exception)
+                    {
+                        // chunks before this one have already been claimed and will complete
+                        state.next = state.last;
+                    }
+                    state.ready.emplace(id, std::move(result));
+                }
+                state.ready_cv.notify_one();
+                state.space_cv.notify_all();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                --state.active_workers;
+            }
+            state.ready_cv.notify_one();
+        }
+
+        template <typename Json>
+        void parse_chunk(const CharT* first, const CharT* last, basic_json_parser<CharT>& parser,
+            json_decoder<Json>& decoder, chunk_result<Json>& result)
+        {
+            const CharT* p = first;
+            while (p != last)
+            {
+                const CharT* eol = std::find(p, last, '\n');
+                ++result.lines;
+                if (!is_blank(p, eol))
+                {
+                    std::error_code ec;
+                    parser.reset();
+                    parser.update(p, static_cast<std::size_t>(eol - p));
+                    parser.parse_some(decoder, ec);
+                    if (!ec)
+                    {
+                        parser.finish_parse(decoder, ec);
+                    }
+                    if (!ec)
+                    {
+                        parser.check_done(ec);
+                    }
+                    if (!ec && !decoder.is_valid())
+                    {
+                        ec = json_errc::source_error;
+                    }
+                    if (ec)
+                    {
+                        result.ec = ec;
+                        result.error_line = result.lines;
+                        result.error_column = parser.column();
+                        decoder.reset();
+                        return;
+                    }
+                    result.values.push_back(decoder.get_result());
+                }
+                p = eol == last ? last : eol + 1;
+            }
+        }
+
+        template <typename Json,typename Callback>
+        void consume(shared_state<Json>& state, Callback& callback, std::error_code& ec)
+        {
+            std::size_t expected = 0;
+            while (true)
+            {
+                chunk_result<Json> result;
+                std::size_t id;
+                {
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    if (options_.ordered())
+                    {
+                        state.ready_cv.wait(lock, [&]() {return state.ready.count(expected) != 0 || state.active_workers == 0;});
+                        auto it = state.ready.find(expected);
+                        if (it == state.ready.end())
+                        {
+                            return;
+                        }
+                        id = it->first;
+                        result = std::move(it->second);
+                        state.ready.erase(it);
+                        ++expected;
+                    }
+                    else
+                    {
+                        state.ready_cv.wait(lock, [&]() {return !state.ready.empty() || state.active_workers == 0;});
+                        if (state.ready.empty())
+                        {
+                            return;
+                        }
+                        auto it = state.ready.begin();
+                        id = it->first;
+                        result = std::move(it->second);
+                        state.ready.erase(it);
+                    }
+                    ++state.delivered;
+                }
+                state.space_cv.notify_one();
+
+                for (auto& value : result.values)
+                {
+                    callback(std::move(value));
+                }
+                if (result.exception)
+                {
+                    std::rethrow_exception(result.exception);
+                }
+                if (result.ec)
+                {
+                    // Every chunk before id was claimed before this one, wait for their line counts
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    state.ready_cv.wait(lock, [&]() {return state.active_workers == 0;});
+                    std::size_t line = 0;
+                    for (std::size_t i = 0; i < id; ++i)
+                    {
+                        line += state.line_counts[i];
+                    }
+                    ec = result.ec;
+                    line_ = line + result.error_line;
+                    column_ = result.error_column;
+                    return;
+                }
+            }
+        }
+    };
+
+    using json_lines_reader = basic_json_lines_reader<char>;
+    using wjson_lines_reader = basic_json_lines_reader<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_LINES_READER_HPP
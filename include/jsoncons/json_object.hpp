@@ -9,9 +9,11 @@
 
 #include <algorithm> // std::sort, std::stable_sort, std::lower_bound, std::unique
 #include <cassert> // assert
+#include <cstdint>
 #include <cstring>
 #include <initializer_list>
 #include <iterator> // std::iterator_traits
+#include <limits>
 #include <memory> // std::allocator
 #include <string>
 #include <tuple>
@@ -537,14 +539,14 @@ namespace jsoncons {
                 members_.reserve(count);
 
                 std::sort(items, items+count, compare);
-                members_.emplace_back(key_type(items[0].name.data(), items[0].name.size(), get_allocator()), std::move(items[0].value));
+                members_.emplace_back(key_type(std::move(items[0].name), get_allocator()), std::move(items[0].value));
                 
                 for (std::size_t i = 1; i < count; ++i)
                 {
                     auto& item = items[i];
-                    if (item.name != items[i-1].name)
+                    if (item.name != members_.back().key())
                     {
-                        members_.emplace_back(key_type(item.name.data(), item.name.size(), get_allocator()), std::move(item.value));
+                        members_.emplace_back(key_type(std::move(item.name), get_allocator()), std::move(item.value));
                     }
                 }
             }
@@ -1013,27 +1015,42 @@ namespace jsoncons {
         using string_view_type = typename Json::string_view_type;
         using key_value_type = key_value<KeyT,Json>;
     private:
+        // FNV-1a
+        static std::size_t hash_key(const char_type* s, std::size_t length) noexcept
+        {
+            using uchar_type = typename std::make_unsigned<char_type>::type;
+            uint64_t hash_value = 14695981039346656037ull;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                hash_value ^= static_cast<uchar_type>(s[i]);
+                hash_value *= 1099511628211ull;
+            }
+            return static_cast<std::size_t>(hash_value ^ (hash_value >> 32));
+        }
+
         struct MyHash
         {
-            std::uintmax_t operator()(const key_type& s) const noexcept
+            std::size_t operator()(const key_type& s) const noexcept
             {
-                const int p = 31;
-                const int m = static_cast<int>(1e9) + 9;
-                std::uintmax_t hash_value = 0;
-                std::uintmax_t p_pow = 1;
-                for (char_type c : s) {
-                    hash_value = (hash_value + (c - 'a' + 1) * p_pow) % m;
-                    p_pow = (p_pow * p) % m;
-                }
-                return hash_value;   
+                return hash_key(s.data(), s.size());
             }
         };
 
         using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;
         using key_value_container_type = SequenceContainer<key_value_type,key_value_allocator_type>;
+        using index_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint32_t>;
+        using index_container_type = std::vector<uint32_t,index_allocator_type>;
+
+        // Objects with fewer members are searched linearly
+        static constexpr std::size_t min_indexed_size = 16;
 
         key_value_container_type members_;
 
+        // Open addressing table of member positions plus one (zero marks an empty slot),
+        // built on the first lookup once there are min_indexed_size members, and
+        // maintained by appends and erases until cleared.
+        mutable index_container_type index_;
+
         struct Comp
         {
             const key_value_container_type& members_;
@@ -1057,31 +1074,37 @@ namespace jsoncons {
         }
         order_preserving_json_object(const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
         }
 
         order_preserving_json_object(const order_preserving_json_object& val)
             : allocator_holder<allocator_type>(val.get_allocator()), 
-              members_(val.members_)
+              members_(val.members_),
+              index_(index_allocator_type(val.get_allocator()))
         {
         }
 
         order_preserving_json_object(order_preserving_json_object&& val,const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(std::move(val.members_),key_value_allocator_type(alloc))
+              members_(std::move(val.members_),key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
+            val.index_.clear();
         }
 
         order_preserving_json_object(order_preserving_json_object&& val) noexcept
             : allocator_holder<allocator_type>(val.get_allocator()), 
-              members_(std::move(val.members_))
+              members_(std::move(val.members_)),
+              index_(std::move(val.index_))
         {
         }
 
         order_preserving_json_object(const order_preserving_json_object& val, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(val.members_,key_value_allocator_type(alloc))
+              members_(val.members_,key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
         }
 
@@ -1105,7 +1128,8 @@ namespace jsoncons {
         template <typename InputIt>
         order_preserving_json_object(InputIt first, InputIt last, const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
             std::unordered_set<key_type,MyHash> keys;
             for (auto it = first; it != last; ++it)
@@ -1122,7 +1146,8 @@ namespace jsoncons {
         order_preserving_json_object(std::initializer_list<std::pair<std::basic_string<char_type>,Json>> init, 
                     const allocator_type& alloc = allocator_type())
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
             members_.reserve(init.size());
             for (auto& item : init)
@@ -1145,12 +1170,14 @@ namespace jsoncons {
         order_preserving_json_object& operator=(const order_preserving_json_object& val)
         {
             members_ = val.members_;
+            index_.clear();
             return *this;
         }
 
         void swap(order_preserving_json_object& other) noexcept
         {
             members_.swap(other.members_);
+            index_.swap(other.index_);
         }
 
         bool empty() const
@@ -1185,6 +1212,7 @@ namespace jsoncons {
         void clear() 
         {
             members_.clear();
+            index_.clear();
         }
 
         void shrink_to_fit() 
@@ -1218,44 +1246,19 @@ namespace jsoncons {
 
         iterator find(const string_view_type& name) noexcept
         {
-            bool found = false;
-            auto it = members_.begin();
-            while (!found && it != members_.end())
-            {
-                if ((*it).key() == name)
-                {
-                    found = true;
-                }
-                else
-                {
-                    ++it;
-                }
-            }
-            return it;
+            return members_.begin() + find_position(name);
         }
 
         const_iterator find(const string_view_type& name) const noexcept
         {
-            bool found = false;
-            auto it = members_.begin();
-            while (!found && it != members_.end())
-            {
-                if ((*it).key() == name)
-                {
-                    found = true;
-                }
-                else
-                {
-                    ++it;
-                }
-            }
-            return it;
+            return members_.begin() + find_position(name);
         }
 
         iterator erase(const_iterator pos) 
         {
             if (pos != members_.end())
             {
+                index_erase(static_cast<std::size_t>(pos - members_.begin()));
                 return members_.erase(pos);
             }
             else
@@ -1271,7 +1274,7 @@ namespace jsoncons {
 
             if (pos1 < members_.size() && pos2 <= members_.size())
             {
-
+                index_.clear();
                 return members_.erase(first,last);
             }
             else
@@ -1282,10 +1285,11 @@ namespace jsoncons {
 
         void erase(const string_view_type& name) 
         {
-            auto pos = find(name);
-            if (pos != members_.end())
+            std::size_t pos = find_position(name);
+            if (pos != members_.size())
             {
-                members_.erase(pos);
+                index_erase(pos);
+                members_.erase(members_.begin() + pos);
             }
         }
 
@@ -1328,6 +1332,7 @@ namespace jsoncons {
 
                 std::sort(items, items+count, compare2);
 
+                index_.clear();
                 members_.reserve(count);
 
                 for (std::size_t i = 0; i < count; ++i)
@@ -1348,6 +1353,7 @@ namespace jsoncons {
                 {
                     keys.emplace(key.c_str(), key.size(), get_allocator());
                     members_.emplace_back(std::move(key), (*it).second);
+                    index_push_back();
                 }
             }
         }
@@ -1358,6 +1364,7 @@ namespace jsoncons {
             for (auto it = first; it != last; ++it)
             {
                 members_.emplace_back(make_key_value<KeyT,Json>()(*it));
+                index_push_back();
             }
         }
    
@@ -1369,6 +1376,7 @@ namespace jsoncons {
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(), name.end()), std::forward<T>(value));
+                index_push_back();
                 auto pos = members_.begin() + (members_.size() - 1);
                 return std::make_pair(pos, true);
             }
@@ -1387,6 +1395,7 @@ namespace jsoncons {
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(),name.end(),get_allocator()), std::forward<T>(value));
+                index_push_back();
                 auto pos = members_.begin() + (members_.size()-1);
                 return std::make_pair(pos,true);
             }
@@ -1412,6 +1421,7 @@ namespace jsoncons {
                 if (it == members_.end())
                 {
                     members_.emplace_back(key_type(key.begin(), key.end()), std::forward<T>(value));
+                    index_push_back();
                     auto pos = members_.begin() + (members_.size() - 1);
                     return pos;
                 }
@@ -1438,6 +1448,7 @@ namespace jsoncons {
                 if (it == members_.end())
                 {
                     members_.emplace_back(key_type(key.begin(),key.end(),get_allocator()), std::forward<T>(value));
+                    index_push_back();
                     auto pos = members_.begin() + (members_.size()-1);
                     return pos;
                 }
@@ -1592,6 +1603,7 @@ namespace jsoncons {
             if (it == members_.end())
             {
                 members_.emplace_back(key_type(name.begin(), name.end()), std::forward<Args>(args)...);
+                index_push_back();
                 auto pos = members_.begin() + (members_.size()-1);
                 return std::make_pair(pos,true);
             }
@@ -1610,6 +1622,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                     std::forward<Args>(args)...);
+                index_push_back();
                 auto pos = members_.begin() + members_.size();
                 return std::make_pair(pos,true);
             }
@@ -1635,6 +1648,7 @@ namespace jsoncons {
                 {
                     members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                         std::forward<Args>(args)...);
+                    index_push_back();
                     auto pos = members_.begin() + members_.size();
                     return pos;
                 }
@@ -1661,6 +1675,7 @@ namespace jsoncons {
                 {
                     members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                         std::forward<Args>(args)...);
+                    index_push_back();
                     auto pos = members_.begin() + members_.size();
                     return pos;
                 }
@@ -1682,8 +1697,124 @@ namespace jsoncons {
         }
     private:
 
+        std::size_t find_position(const string_view_type& name) const noexcept
+        {
+            if (members_.size() < min_indexed_size || members_.size() >= (std::numeric_limits<uint32_t>::max)())
+            {
+                std::size_t i = 0;
+                while (i < members_.size() && !(members_[i].key() == name))
+                {
+                    ++i;
+                }
+                return i;
+            }
+            if (index_.empty())
+            {
+                build_index();
+            }
+            const std::size_t mask = index_.size() - 1;
+            for (std::size_t slot = hash_key(name.data(), name.size()) & mask; index_[slot] != 0; slot = (slot + 1) & mask)
+            {
+                const std::size_t pos = index_[slot] - 1;
+                if (members_[pos].key() == name)
+                {
+                    return pos;
+                }
+            }
+            return members_.size();
+        }
+
+        std::size_t home_slot(std::size_t pos) const noexcept
+        {
+            const key_type& key = members_[pos].key();
+            return hash_key(key.data(), key.size()) & (index_.size() - 1);
+        }
+
+        void build_index() const
+        {
+            std::size_t capacity = 2*min_indexed_size;
+            while (capacity < 2*members_.size())
+            {
+                capacity *= 2;
+            }
+            index_.assign(capacity, 0);
+            for (std::size_t pos = 0; pos < members_.size(); ++pos)
+            {
+                std::size_t slot = home_slot(pos);
+                while (index_[slot] != 0)
+                {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                index_[slot] = static_cast<uint32_t>(pos + 1);
+            }
+        }
+
+        // Called after a member is appended
+        void index_push_back()
+        {
+            if (index_.empty())
+            {
+                return;
+            }
+            if (2*members_.size() > index_.size() || members_.size() >= (std::numeric_limits<uint32_t>::max)())
+            {
+                index_.clear();
+                return;
+            }
+            const std::size_t pos = members_.size() - 1;
+            std::size_t slot = home_slot(pos);
+            while (index_[slot] != 0)
+            {
+                slot = (slot + 1) & (index_.size() - 1);
+            }
+            index_[slot] = static_cast<uint32_t>(pos + 1);
+        }
+
+        // Called before the member at pos is erased
+        void index_erase(std::size_t pos) noexcept
+        {
+            if (index_.empty())
+            {
+                return;
+            }
+            if (members_.size() <= min_indexed_size)
+            {
+                index_.clear();
+                return;
+            }
+            const std::size_t mask = index_.size() - 1;
+            std::size_t hole = home_slot(pos);
+            while (index_[hole] != pos + 1)
+            {
+                hole = (hole + 1) & mask;
+            }
+            // Backward shift deletion, moves up entries whose probe sequence passes through the hole
+            for (std::size_t slot = (hole + 1) & mask; index_[slot] != 0; slot = (slot + 1) & mask)
+            {
+                const std::size_t home = home_slot(index_[slot] - 1);
+                const bool stays = hole < slot ? (hole < home && home <= slot) : (hole < home || home <= slot);
+                if (!stays)
+                {
+                    index_[hole] = index_[slot];
+                    hole = slot;
+                }
+            }
+            index_[hole] = 0;
+            for (auto& entry : index_)
+            {
+                if (entry > pos + 1)
+                {
+                    --entry;
+                }
+            }
+        }
+
         iterator find(iterator hint, const string_view_type& name) noexcept
         {
+            if (members_.size() >= min_indexed_size)
+            {
+                return find(name);
+            }
             bool found = false;
             auto it = hint;
             while (!found && it != members_.end())
@@ -256,6 +256,7 @@ private:
     bool lossless_bignum_{true};
     bool allow_comments_{true};
     bool allow_trailing_comma_{false};
+    bool structural_index_{false};
     std::function<bool(json_errc,const ser_context&)> err_handler_;
 public:
     basic_json_decode_options()
@@ -271,6 +272,7 @@ public:
           lossless_bignum_(other.lossless_bignum_), 
           allow_comments_(other.allow_comments_), 
           allow_trailing_comma_(other.allow_trailing_comma_), 
+          structural_index_(other.structural_index_), 
           err_handler_(std::move(other.err_handler_))
     {
     }
@@ -297,6 +299,11 @@ public:
         return allow_trailing_comma_;
     }
 
+    bool structural_index() const 
+    {
+        return structural_index_;
+    }
+
     const std::function<bool(json_errc,const ser_context&)>& err_handler() const 
     {
         return err_handler_;
@@ -485,6 +492,7 @@ public:
     using basic_json_decode_options<CharT>::lossless_bignum;
     using basic_json_decode_options<CharT>::allow_comments;
     using basic_json_decode_options<CharT>::allow_trailing_comma;
+    using basic_json_decode_options<CharT>::structural_index;
     using basic_json_decode_options<CharT>::err_handler;
 
     using basic_json_encode_options<CharT>::byte_string_format;
@@ -646,6 +654,12 @@ public:
         return *this;
     }
 
+    basic_json_options& structural_index(bool value) 
+    {
+        this->structural_index_ = value;
+        return *this;
+    }
+
     basic_json_options& err_handler(const std::function<bool(json_errc,const ser_context&)>& value) 
     {
         this->err_handler_ = value;
@@ -19,6 +19,8 @@
 #include <vector>
 
 #include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/string_scan.hpp>
+#include <jsoncons/detail/structural_index.hpp>
 #include <jsoncons/utility/read_number.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/json_exception.hpp>
@@ -123,6 +125,9 @@ private:
     using temp_allocator_type = TempAlloc;
     using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT>;
     using parse_state_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<parse_state>;
+    using offset_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<uint32_t>;
+
+    enum class index_state : uint8_t {none, built, unavailable};
 
     static constexpr std::size_t initial_buffer_capacity = 256;
     static constexpr int default_initial_stack_capacity = 66;
@@ -132,6 +137,7 @@ private:
     bool allow_comments_;    
     bool lossless_number_;    
     bool lossless_bignum_;    
+    bool structural_index_enabled_;
 
     std::function<bool(json_errc,const ser_context&)> err_handler_;
     int level_{0};
@@ -153,11 +159,17 @@ private:
     int mark_level_{0};
     
     semantic_tag escape_tag_;
+    bool string_non_ascii_{false};
     std::basic_string<char_type,std::char_traits<char_type>,char_allocator_type> buffer_;
 
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
     std::vector<std::pair<std::basic_string<char_type>,double>> string_double_map_;
 
+    detail::basic_structural_index<char_type,offset_allocator_type> structural_index_;
+    index_state index_state_{index_state::none};
+    const char_type* index_base_{nullptr};
+    std::size_t index_pos_{0};
+
     // Noncopyable and nonmoveable
     basic_json_parser(const basic_json_parser&) = delete;
     basic_json_parser& operator=(const basic_json_parser&) = delete;
@@ -188,9 +200,11 @@ public:
          allow_comments_(options.allow_comments()),
          lossless_number_(options.lossless_number()),
          lossless_bignum_(options.lossless_bignum()),
+         structural_index_enabled_(options.structural_index()),
          err_handler_(err_handler),
          buffer_(temp_alloc),
-         state_stack_(temp_alloc)
+         state_stack_(temp_alloc),
+         structural_index_(temp_alloc)
     {
         buffer_.reserve(initial_buffer_capacity);
 
@@ -483,6 +497,7 @@ public:
         position_ = 0;
         mark_position_ = 0;
         level_ = 0;
+        index_state_ = index_state::none;
     }
 
     void restart()
@@ -534,6 +549,7 @@ public:
         begin_input_ = data;
         end_input_ = data + length;
         input_ptr_ = begin_input_;
+        index_state_ = index_state::none;
     }
 
     void parse_some(basic_json_visitor<char_type>& visitor)
@@ -627,6 +643,12 @@ public:
             }
         }
 
+        if (structural_index_enabled_ && more_)
+        {
+            parse_indexed(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+        }
+
         while ((input_ptr_ < local_input_end) && more_)
         {
             switch (state_)
@@ -694,6 +716,7 @@ public:
                             ++input_ptr_;
                             ++position_;
                             escape_tag_ = semantic_tag::noesc;
+                            string_non_ascii_ = false;
                             buffer_.clear();
                             input_ptr_ = parse_string(input_ptr_, visitor, ec);
                             if (JSONCONS_UNLIKELY(ec)) return;
@@ -880,6 +903,7 @@ public:
                             state_ = parse_state::string;
                             string_state_ = parse_string_state{};
                             escape_tag_ = semantic_tag::noesc;
+                            string_non_ascii_ = false;
                             buffer_.clear();
                             input_ptr_ = parse_string(input_ptr_, visitor, ec);
                             if (JSONCONS_UNLIKELY(ec)) return;
@@ -938,6 +962,7 @@ public:
                             state_ = parse_state::string;
                             string_state_ = parse_string_state{};
                             escape_tag_ = semantic_tag::noesc;
+                            string_non_ascii_ = false;
                             buffer_.clear();
                             input_ptr_ = parse_string(input_ptr_, visitor, ec);
                             if (JSONCONS_UNLIKELY(ec)) return;
@@ -1066,6 +1091,7 @@ public:
                             state_ = parse_state::string;
                             string_state_ = parse_string_state{};
                             escape_tag_ = semantic_tag::noesc;
+                            string_non_ascii_ = false;
                             buffer_.clear();
                             input_ptr_ = parse_string(input_ptr_, visitor, ec);
                             if (JSONCONS_UNLIKELY(ec)) return;
@@ -1218,6 +1244,7 @@ public:
                             state_ = parse_state::string;
                             string_state_ = parse_string_state{};
                             escape_tag_ = semantic_tag::noesc;
+                            string_non_ascii_ = false;
                             buffer_.clear();
                             input_ptr_ = parse_string(input_ptr_, visitor, ec);
                             if (JSONCONS_UNLIKELY(ec)) return;
@@ -1954,8 +1981,14 @@ exp3:
         }
 
 text:
-        while (cur < local_input_end)
+        while (true)
         {
+            // Skip in bulk to the next character that needs attention
+            cur = detail::skip_string_text(cur, local_input_end, string_non_ascii_);
+            if (cur >= local_input_end)
+            {
+                break;
+            }
             switch (*cur)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -2424,6 +2457,217 @@ private:
         *ptr = cur;
     }
 
+    // Stage 2 of two stage parsing: moves from token to token using the structural index.
+    // It handles only what is regular in well formed JSON, and leaves anything else
+    // (comments, errors, tokens split across buffers) to the state machine in parse_some_,
+    // which continues from the same input position and state.
+    void parse_indexed(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        while (more_)
+        {
+            switch (state_)
+            {
+                case parse_state::start:
+                case parse_state::expect_value:
+                case parse_state::expect_value_or_end:
+                case parse_state::expect_member_name:
+                case parse_state::expect_member_name_or_end:
+                case parse_state::expect_colon:
+                case parse_state::expect_comma_or_end:
+                    break;
+                default:
+                    return;
+            }
+            if (index_state_ == index_state::none)
+            {
+                index_base_ = input_ptr_;
+                index_pos_ = 0;
+                index_state_ = structural_index_.build(input_ptr_, end_input_ - input_ptr_) ? index_state::built : index_state::unavailable;
+            }
+            if (index_state_ != index_state::built)
+            {
+                return;
+            }
+
+            const std::size_t offset = static_cast<std::size_t>(input_ptr_ - index_base_);
+            const std::size_t count = structural_index_.size();
+            while (index_pos_ < count && structural_index_[index_pos_] < offset)
+            {
+                ++index_pos_;
+            }
+            if (index_pos_ == count)
+            {
+                return;
+            }
+            const char_type* next = index_base_ + structural_index_[index_pos_];
+            if (next != input_ptr_)
+            {
+                skip_space(&input_ptr_);
+                if (input_ptr_ != next)
+                {
+                    return;
+                }
+            }
+
+            switch (state_)
+            {
+                case parse_state::expect_colon:
+                    if (*input_ptr_ != ':')
+                    {
+                        return;
+                    }
+                    state_ = parse_state::expect_value;
+                    ++input_ptr_;
+                    ++position_;
+                    break;
+                case parse_state::expect_comma_or_end:
+                    switch (*input_ptr_)
+                    {
+                        case ',':
+                            begin_member_or_element(ec);
+                            if (JSONCONS_UNLIKELY(ec)) return;
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        case '}':
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            end_object(visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) return;
+                            break;
+                        case ']':
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            end_array(visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) return;
+                            break;
+                        default:
+                            return;
+                    }
+                    break;
+                case parse_state::expect_member_name_or_end:
+                    if (*input_ptr_ == '}')
+                    {
+                        begin_position_ = position_;
+                        ++input_ptr_;
+                        ++position_;
+                        end_object(visitor, ec);
+                        if (JSONCONS_UNLIKELY(ec)) return;
+                        break;
+                    }
+                    JSONCONS_FALLTHROUGH;
+                case parse_state::expect_member_name:
+                    if (*input_ptr_ != '"')
+                    {
+                        return;
+                    }
+                    begin_position_ = position_;
+                    ++input_ptr_;
+                    ++position_;
+                    push_state(parse_state::member_name);
+                    state_ = parse_state::string;
+                    string_state_ = parse_string_state{};
+                    escape_tag_ = semantic_tag::noesc;
+                    string_non_ascii_ = false;
+                    buffer_.clear();
+                    input_ptr_ = parse_string(input_ptr_, visitor, ec);
+                    if (JSONCONS_UNLIKELY(ec)) return;
+                    break;
+                case parse_state::expect_value_or_end:
+                    if (*input_ptr_ == ']')
+                    {
+                        begin_position_ = position_;
+                        ++input_ptr_;
+                        ++position_;
+                        end_array(visitor, ec);
+                        if (JSONCONS_UNLIKELY(ec)) return;
+                        break;
+                    }
+                    JSONCONS_FALLTHROUGH;
+                default: // start, expect_value
+                    switch (*input_ptr_)
+                    {
+                        case '{':
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            begin_object(visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) return;
+                            break;
+                        case '[':
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            begin_array(visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) return;
+                            break;
+                        case '\"':
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            state_ = parse_state::string;
+                            string_state_ = parse_string_state{};
+                            escape_tag_ = semantic_tag::noesc;
+                            string_non_ascii_ = false;
+                            buffer_.clear();
+                            input_ptr_ = parse_string(input_ptr_, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) return;
+                            break;
+                        case '-':
+                            buffer_.clear();
+                            buffer_.push_back('-');
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            state_ = parse_state::number;
+                            number_state_ = parse_number_state::minus;
+                            input_ptr_ = parse_number(input_ptr_, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            break;
+                        case '0': 
+                            buffer_.clear();
+                            buffer_.push_back(static_cast<char>(*input_ptr_));
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            state_ = parse_state::number;
+                            number_state_ = parse_number_state::zero;
+                            input_ptr_ = parse_number(input_ptr_, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            break;
+                        case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
+                            buffer_.clear();
+                            buffer_.push_back(static_cast<char>(*input_ptr_));
+                            begin_position_ = position_;
+                            ++input_ptr_;
+                            ++position_;
+                            state_ = parse_state::number;
+                            number_state_ = parse_number_state::integer;
+                            input_ptr_ = parse_number(input_ptr_, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            break;
+                        case 'n':
+                            parse_null(visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            break;
+                        case 't':
+                            input_ptr_ = parse_true(input_ptr_, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            break;
+                        case 'f':
+                            input_ptr_ = parse_false(input_ptr_, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            break;
+                        default:
+                            return;
+                    }
+                    break;
+            }
+        }
+    }
+
     void end_integer_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
     {
         if (buffer_[0] == '-')
@@ -2514,12 +2758,16 @@ private:
     void end_string_value(const char_type* s, std::size_t length, basic_json_visitor<char_type>& visitor, std::error_code& ec) 
     {
         string_view_type sv(s, length);
-        auto result = unicode_traits::validate(s, length);
-        if (result.ec != unicode_traits::conv_errc())
+        // Text that is all ASCII and has no escapes is valid UTF-8
+        if (string_non_ascii_ || escape_tag_ != semantic_tag::noesc)
         {
-            translate_conv_errc(result.ec,ec);
-            position_ += (result.ptr - s);
-            return;
+            auto result = unicode_traits::validate(s, length);
+            if (result.ec != unicode_traits::conv_errc())
+            {
+                translate_conv_errc(result.ec,ec);
+                position_ += (result.ptr - s);
+                return;
+            }
         }
         switch (parent())
         {
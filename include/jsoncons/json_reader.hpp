@@ -22,6 +22,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/semantic_tag.hpp>
 #include <jsoncons/ser_util.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <jsoncons/source.hpp>
 #include <jsoncons/source_adaptor.hpp>
 #include <jsoncons/utility/unicode_traits.hpp>
@@ -431,6 +432,7 @@ namespace jsoncons {
     using wjson_string_reader = basic_json_reader<wchar_t,string_source<wchar_t>>;
     using json_stream_reader = basic_json_reader<char,stream_source<char>>;
     using wjson_stream_reader = basic_json_reader<wchar_t,stream_source<wchar_t>>;
+    using json_file_reader = basic_json_reader<char,mmap_source<char>>;
 
 }
 
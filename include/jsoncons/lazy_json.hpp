@@ -0,0 +1,989 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_LAZY_JSON_HPP
+#define JSONCONS_LAZY_JSON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory> // std::allocator
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/conv_error.hpp>
+#include <jsoncons/decode_json.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/ser_util.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+#include <jsoncons/utility/read_number.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    enum class lazy_json_kind : uint8_t {null_value, true_value, false_value, number, string, array, object};
+
+    struct lazy_json_flags
+    {
+        static constexpr uint8_t has_escapes = 0x01;
+        static constexpr uint8_t is_integer = 0x02;
+        static constexpr uint8_t is_negative = 0x04;
+    };
+
+    // Strings of CharT, which lazy_json values can return without decoding
+    template <typename T,typename CharT,typename Enable=void>
+    struct is_lazy_json_string : std::false_type {};
+
+    template <typename T,typename CharT>
+    struct is_lazy_json_string<T,CharT,
+        typename std::enable_if<(ext_traits::is_string<T>::value || ext_traits::is_string_view<T>::value) &&
+                                std::is_same<typename T::value_type,CharT>::value>::type> : std::true_type {};
+
+    // One entry per value and object key, in document order. A container is followed
+    // by the entries of its elements, object members as key, value pairs.
+    struct lazy_json_entry
+    {
+        std::size_t offset; // first character of the value
+        std::size_t length; // through the closing quote or bracket
+        std::size_t next;   // index of the entry following this value and its descendants
+        std::size_t size;   // number of elements or members
+        lazy_json_kind kind;
+        uint8_t flags;
+    };
+
+    // Builds the structural index. Checks the structure and the lexical form of
+    // every token, string and number contents are decoded on access.
+    template <typename CharT,typename EntryAllocator>
+    class lazy_json_indexer
+    {
+        struct frame
+        {
+            std::size_t entry;
+            std::size_t count;
+            bool is_object;
+        };
+
+        enum class state {value, first_element, first_member, key, after_value};
+
+        const CharT* data_;
+        std::size_t length_;
+        std::size_t pos_{0};
+        std::size_t max_nesting_depth_;
+        std::vector<lazy_json_entry,EntryAllocator>& entries_;
+    public:
+        lazy_json_indexer(const CharT* data, std::size_t length, std::size_t max_nesting_depth,
+            std::vector<lazy_json_entry,EntryAllocator>& entries)
+            : data_(data), length_(length), max_nesting_depth_(max_nesting_depth), entries_(entries)
+        {
+        }
+
+        std::size_t position() const
+        {
+            return pos_;
+        }
+
+        void run(std::error_code& ec)
+        {
+            std::vector<frame> stack;
+            state st = state::value;
+
+            while (true)
+            {
+                skip_whitespace();
+                if (st == state::after_value)
+                {
+                    if (stack.empty())
+                    {
+                        if (pos_ != length_)
+                        {
+                            ec = json_errc::extra_character;
+                        }
+                        return;
+                    }
+                    if (pos_ == length_)
+                    {
+                        ec = json_errc::unexpected_eof;
+                        return;
+                    }
+                    frame& f = stack.back();
+                    const CharT c = data_[pos_];
+                    if (c == ',')
+                    {
+                        ++pos_;
+                        st = f.is_object ? state::key : state::value;
+                    }
+                    else if ((c == '}' && f.is_object) || (c == ']' && !f.is_object))
+                    {
+                        close(stack);
+                    }
+                    else
+                    {
+                        ec = f.is_object ? json_errc::expected_comma_or_rbrace : json_errc::expected_comma_or_rbracket;
+                        return;
+                    }
+                    continue;
+                }
+                if (pos_ == length_)
+                {
+                    ec = json_errc::unexpected_eof;
+                    return;
+                }
+                const CharT c = data_[pos_];
+                switch (st)
+                {
+                    case state::first_element:
+                        if (c == ']')
+                        {
+                            close(stack);
+                            st = state::after_value;
+                            continue;
+                        }
+                        break;
+                    case state::first_member:
+                        if (c == '}')
+                        {
+                            close(stack);
+                            st = state::after_value;
+                            continue;
+                        }
+                        JSONCONS_FALLTHROUGH;
+                    case state::key:
+                    {
+                        if (c != '"')
+                        {
+                            ec = c == '}' ? json_errc::extra_comma : json_errc::expected_key;
+                            return;
+                        }
+                        scan_string(ec);
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return;
+                        }
+                        skip_whitespace();
+                        if (pos_ == length_ || data_[pos_] != ':')
+                        {
+                            ec = pos_ == length_ ? json_errc::unexpected_eof : json_errc::expected_colon;
+                            return;
+                        }
+                        ++pos_;
+                        st = state::value;
+                        continue;
+                    }
+                    default:
+                        break;
+                }
+
+                // A value
+                switch (c)
+                {
+                    case '{':
+                    case '[':
+                        if (stack.size() >= max_nesting_depth_)
+                        {
+                            ec = json_errc::max_nesting_depth_exceeded;
+                            return;
+                        }
+                        stack.push_back(frame{entries_.size(), 0, c == '{'});
+                        add_entry(pos_, 0, c == '{' ? lazy_json_kind::object : lazy_json_kind::array, 0);
+                        ++pos_;
+                        st = c == '{' ? state::first_member : state::first_element;
+                        continue;
+                    case '"':
+                        scan_string(ec);
+                        break;
+                    case '-': case '0': case '1': case '2': case '3': case '4':
+                    case '5': case '6': case '7': case '8': case '9':
+                        scan_number(ec);
+                        break;
+                    case 't':
+                        scan_literal("true", 4, lazy_json_kind::true_value, ec);
+                        break;
+                    case 'f':
+                        scan_literal("false", 5, lazy_json_kind::false_value, ec);
+                        break;
+                    case 'n':
+                        scan_literal("null", 4, lazy_json_kind::null_value, ec);
+                        break;
+                    case ']':
+                        ec = stack.empty() ? json_errc::unexpected_rbracket : json_errc::extra_comma;
+                        break;
+                    case '}':
+                        ec = json_errc::unexpected_rbrace;
+                        break;
+                    default:
+                        ec = json_errc::expected_value;
+                        break;
+                }
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+                if (!stack.empty())
+                {
+                    ++stack.back().count;
+                }
+                st = state::after_value;
+            }
+        }
+
+    private:
+        void add_entry(std::size_t offset, std::size_t length, lazy_json_kind kind, uint8_t flags)
+        {
+            entries_.push_back(lazy_json_entry{offset, length, entries_.size() + 1, 0, kind, flags});
+        }
+
+        void close(std::vector<frame>& stack)
+        {
+            lazy_json_entry& e = entries_[stack.back().entry];
+            e.length = pos_ + 1 - e.offset;
+            e.next = entries_.size();
+            e.size = stack.back().count;
+            stack.pop_back();
+            ++pos_;
+            if (!stack.empty())
+            {
+                ++stack.back().count;
+            }
+        }
+
+        void skip_whitespace()
+        {
+            while (pos_ < length_)
+            {
+                const CharT c = data_[pos_];
+                if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+                {
+                    break;
+                }
+                ++pos_;
+            }
+        }
+
+        static bool is_hex(CharT c)
+        {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        }
+
+        void scan_string(std::error_code& ec)
+        {
+            const std::size_t start = pos_++;
+            uint8_t flags = 0;
+            while (pos_ < length_)
+            {
+                const CharT c = data_[pos_];
+                if (c == '"')
+                {
+                    ++pos_;
+                    add_entry(start, pos_ - start, lazy_json_kind::string, flags);
+                    return;
+                }
+                if (c == '\\')
+                {
+                    flags |= lazy_json_flags::has_escapes;
+                    if (pos_ + 1 == length_)
+                    {
+                        break;
+                    }
+                    switch (data_[pos_+1])
+                    {
+                        case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                            pos_ += 2;
+                            break;
+                        case 'u':
+                            if (pos_ + 6 > length_ || !is_hex(data_[pos_+2]) || !is_hex(data_[pos_+3]) ||
+                                !is_hex(data_[pos_+4]) || !is_hex(data_[pos_+5]))
+                            {
+                                ec = json_errc::invalid_unicode_escape_sequence;
+                                return;
+                            }
+                            pos_ += 6;
+                            break;
+                        default:
+                            ++pos_;
+                            ec = json_errc::illegal_escaped_character;
+                            return;
+                    }
+                    continue;
+                }
+                if (static_cast<typename std::make_unsigned<CharT>::type>(c) < 0x20)
+                {
+                    ec = json_errc::illegal_control_character;
+                    return;
+                }
+                ++pos_;
+            }
+            ec = json_errc::unexpected_eof;
+        }
+
+        void scan_digits()
+        {
+            while (pos_ < length_ && data_[pos_] >= '0' && data_[pos_] <= '9')
+            {
+                ++pos_;
+            }
+        }
+
+        void scan_number(std::error_code& ec)
+        {
+            const std::size_t start = pos_;
+            uint8_t flags = lazy_json_flags::is_integer;
+            if (data_[pos_] == '-')
+            {
+                flags |= lazy_json_flags::is_negative;
+                ++pos_;
+            }
+            if (pos_ == length_ || data_[pos_] < '0' || data_[pos_] > '9')
+            {
+                ec = pos_ == length_ ? json_errc::unexpected_eof : json_errc::invalid_number;
+                return;
+            }
+            if (data_[pos_] == '0')
+            {
+                ++pos_;
+                if (pos_ < length_ && data_[pos_] >= '0' && data_[pos_] <= '9')
+                {
+                    ec = json_errc::leading_zero;
+                    return;
+                }
+            }
+            else
+            {
+                scan_digits();
+            }
+            if (pos_ < length_ && data_[pos_] == '.')
+            {
+                flags &= ~lazy_json_flags::is_integer;
+                ++pos_;
+                const std::size_t first = pos_;
+                scan_digits();
+                if (pos_ == first)
+                {
+                    ec = json_errc::invalid_number;
+                    return;
+                }
+            }
+            if (pos_ < length_ && (data_[pos_] == 'e' || data_[pos_] == 'E'))
+            {
+                flags &= ~lazy_json_flags::is_integer;
+                ++pos_;
+                if (pos_ < length_ && (data_[pos_] == '+' || data_[pos_] == '-'))
+                {
+                    ++pos_;
+                }
+                const std::size_t first = pos_;
+                scan_digits();
+                if (pos_ == first)
+                {
+                    ec = json_errc::invalid_number;
+                    return;
+                }
+            }
+            add_entry(start, pos_ - start, lazy_json_kind::number, flags);
+        }
+
+        void scan_literal(const char* literal, std::size_t length, lazy_json_kind kind, std::error_code& ec)
+        {
+            if (length_ - pos_ < length)
+            {
+                ec = json_errc::unexpected_eof;
+                return;
+            }
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (data_[pos_+i] != static_cast<CharT>(literal[i]))
+                {
+                    ec = json_errc::invalid_value;
+                    return;
+                }
+            }
+            add_entry(pos_, length, kind, 0);
+            pos_ += length;
+        }
+    };
+
+} // namespace detail
+
+    // A value in a lazy_json document. Views are cheap to copy, and remain valid
+    // as long as the document is neither moved nor destroyed.
+
+    template <typename CharT>
+    class basic_lazy_json_view
+    {
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+        using string_type = std::basic_string<CharT>;
+
+        class object_iterator;
+        class array_iterator;
+        class member;
+
+        template <typename Iterator>
+        class range
+        {
+            Iterator first_;
+            Iterator last_;
+        public:
+            range(Iterator first, Iterator last)
+                : first_(first), last_(last)
+            {
+            }
+
+            Iterator begin() const
+            {
+                return first_;
+            }
+
+            Iterator end() const
+            {
+                return last_;
+            }
+        };
+    private:
+        using entry = detail::lazy_json_entry;
+        using kind = detail::lazy_json_kind;
+
+        const CharT* text_{nullptr};
+        const entry* entries_{nullptr};
+        std::size_t index_{0};
+    public:
+        basic_lazy_json_view() = default;
+
+        basic_lazy_json_view(const CharT* text, const entry* entries, std::size_t index) noexcept
+            : text_(text), entries_(entries), index_(index)
+        {
+        }
+
+        json_type type() const noexcept
+        {
+            switch (current().kind)
+            {
+                case kind::null_value:
+                    return json_type::null_value;
+                case kind::true_value:
+                case kind::false_value:
+                    return json_type::bool_value;
+                case kind::number:
+                    if (current().flags & detail::lazy_json_flags::is_integer)
+                    {
+                        return (current().flags & detail::lazy_json_flags::is_negative) ? json_type::int64_value : json_type::uint64_value;
+                    }
+                    return json_type::double_value;
+                case kind::string:
+                    return json_type::string_value;
+                case kind::array:
+                    return json_type::array_value;
+                default:
+                    return json_type::object_value;
+            }
+        }
+
+        bool is_null() const noexcept
+        {
+            return current().kind == kind::null_value;
+        }
+
+        bool is_bool() const noexcept
+        {
+            return current().kind == kind::true_value || current().kind == kind::false_value;
+        }
+
+        bool is_number() const noexcept
+        {
+            return current().kind == kind::number;
+        }
+
+        bool is_string() const noexcept
+        {
+            return current().kind == kind::string;
+        }
+
+        bool is_array() const noexcept
+        {
+            return current().kind == kind::array;
+        }
+
+        bool is_object() const noexcept
+        {
+            return current().kind == kind::object;
+        }
+
+        // Number of elements or members, 0 for other values
+        std::size_t size() const noexcept
+        {
+            return current().size;
+        }
+
+        bool empty() const noexcept
+        {
+            return is_array() || is_object() ? size() == 0 : false;
+        }
+
+        // The text of the value as it appears in the input
+        string_view_type raw_text() const noexcept
+        {
+            return string_view_type(text_ + current().offset, current().length);
+        }
+
+        bool contains(const string_view_type& key) const noexcept
+        {
+            return find_member(key) != 0;
+        }
+
+        basic_lazy_json_view at(const string_view_type& key) const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            std::size_t i = find_member(key);
+            if (i == 0)
+            {
+                JSONCONS_THROW(key_not_found(key.data(),key.length()));
+            }
+            return basic_lazy_json_view(text_, entries_, i);
+        }
+
+        basic_lazy_json_view at(std::size_t i) const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            if (i >= size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Index out of range"));
+            }
+            std::size_t pos = index_ + 1;
+            for (std::size_t k = 0; k < i; ++k)
+            {
+                pos = entries_[pos].next;
+            }
+            return basic_lazy_json_view(text_, entries_, pos);
+        }
+
+        basic_lazy_json_view operator[](const string_view_type& key) const
+        {
+            return at(key);
+        }
+
+        basic_lazy_json_view operator[](std::size_t i) const
+        {
+            return at(i);
+        }
+
+        // Returns the string without copying, requires that it contains no escapes
+        string_view_type as_string_view() const
+        {
+            if (!is_string() || (current().flags & detail::lazy_json_flags::has_escapes))
+            {
+                JSONCONS_THROW(conv_error(conv_errc::not_string_view));
+            }
+            return string_view_type(text_ + current().offset + 1, current().length - 2);
+        }
+
+        template <typename T>
+        typename std::enable_if<ext_traits::is_bool<T>::value,T>::type
+        as() const
+        {
+            if (current().kind == kind::true_value)
+            {
+                return true;
+            }
+            if (current().kind == kind::false_value)
+            {
+                return false;
+            }
+            return decode_json<T>(raw_text());
+        }
+
+        template <typename T>
+        typename std::enable_if<ext_traits::is_integer<T>::value && !ext_traits::is_bool<T>::value,T>::type
+        as() const
+        {
+            if (current().kind == kind::number && (current().flags & detail::lazy_json_flags::is_integer))
+            {
+                T value{};
+                auto result = jsoncons::utility::dec_to_integer(text_ + current().offset, current().length, value);
+                if (result)
+                {
+                    return value;
+                }
+            }
+            return decode_json<T>(raw_text());
+        }
+
+        template <typename T>
+        typename std::enable_if<ext_traits::is_string<T>::value && detail::is_lazy_json_string<T,CharT>::value,T>::type
+        as() const
+        {
+            if (is_string() && !(current().flags & detail::lazy_json_flags::has_escapes))
+            {
+                return T(text_ + current().offset + 1, current().length - 2);
+            }
+            return decode_json<T>(raw_text());
+        }
+
+        template <typename T>
+        typename std::enable_if<ext_traits::is_string_view<T>::value && detail::is_lazy_json_string<T,CharT>::value,T>::type
+        as() const
+        {
+            string_view_type sv = as_string_view();
+            return T(sv.data(), sv.size());
+        }
+
+        // Anything else, including basic_json, is decoded from the raw text
+        template <typename T>
+        typename std::enable_if<!ext_traits::is_bool<T>::value && !ext_traits::is_integer<T>::value &&
+            !detail::is_lazy_json_string<T,CharT>::value,T>::type
+        as() const
+        {
+            return decode_json<T>(raw_text());
+        }
+
+        range<object_iterator> object_range() const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            return range<object_iterator>(object_iterator(text_, entries_, index_ + 1),
+                object_iterator(text_, entries_, current().next));
+        }
+
+        range<array_iterator> array_range() const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            return range<array_iterator>(array_iterator(text_, entries_, index_ + 1),
+                array_iterator(text_, entries_, current().next));
+        }
+
+        class member
+        {
+            friend class object_iterator;
+
+            basic_lazy_json_view key_;
+            basic_lazy_json_view value_;
+
+            member(const basic_lazy_json_view& key, const basic_lazy_json_view& value)
+                : key_(key), value_(value)
+            {
+            }
+        public:
+            string_type key() const
+            {
+                return key_.template as<string_type>();
+            }
+
+            basic_lazy_json_view value() const
+            {
+                return value_;
+            }
+        };
+
+        class object_iterator
+        {
+            const CharT* text_;
+            const entry* entries_;
+            std::size_t index_;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = member;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const member*;
+            using reference = member;
+
+            object_iterator(const CharT* text, const entry* entries, std::size_t index)
+                : text_(text), entries_(entries), index_(index)
+            {
+            }
+
+            member operator*() const
+            {
+                return member(basic_lazy_json_view(text_, entries_, index_), basic_lazy_json_view(text_, entries_, index_ + 1));
+            }
+
+            object_iterator& operator++()
+            {
+                index_ = entries_[index_ + 1].next;
+                return *this;
+            }
+
+            object_iterator operator++(int)
+            {
+                object_iterator temp(*this);
+                ++(*this);
+                return temp;
+            }
+
+            friend bool operator==(const object_iterator& lhs, const object_iterator& rhs)
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const object_iterator& lhs, const object_iterator& rhs)
+            {
+                return lhs.index_ != rhs.index_;
+            }
+        };
+
+        class array_iterator
+        {
+            const CharT* text_;
+            const entry* entries_;
+            std::size_t index_;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = basic_lazy_json_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const basic_lazy_json_view*;
+            using reference = basic_lazy_json_view;
+
+            array_iterator(const CharT* text, const entry* entries, std::size_t index)
+                : text_(text), entries_(entries), index_(index)
+            {
+            }
+
+            basic_lazy_json_view operator*() const
+            {
+                return basic_lazy_json_view(text_, entries_, index_);
+            }
+
+            array_iterator& operator++()
+            {
+                index_ = entries_[index_].next;
+                return *this;
+            }
+
+            array_iterator operator++(int)
+            {
+                array_iterator temp(*this);
+                ++(*this);
+                return temp;
+            }
+
+            friend bool operator==(const array_iterator& lhs, const array_iterator& rhs)
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const array_iterator& lhs, const array_iterator& rhs)
+            {
+                return lhs.index_ != rhs.index_;
+            }
+        };
+
+    private:
+        const entry& current() const noexcept
+        {
+            return entries_[index_];
+        }
+
+        // Returns the entry index of the value with the given key, 0 if there is none
+        std::size_t find_member(const string_view_type& key) const
+        {
+            if (!is_object())
+            {
+                return 0;
+            }
+            std::size_t pos = index_ + 1;
+            const std::size_t last = current().next;
+            while (pos < last)
+            {
+                const entry& k = entries_[pos];
+                if (k.flags & detail::lazy_json_flags::has_escapes)
+                {
+                    if (basic_lazy_json_view(text_, entries_, pos).template as<string_type>() == key)
+                    {
+                        return pos + 1;
+                    }
+                }
+                else if (k.length - 2 == key.size() &&
+                         std::char_traits<CharT>::compare(text_ + k.offset + 1, key.data(), key.size()) == 0)
+                {
+                    return pos + 1;
+                }
+                pos = entries_[pos + 1].next;
+            }
+            return 0;
+        }
+    };
+
+    // A JSON document that keeps its text and a structural index, and decodes
+    // values only when they are accessed
+
+    template <typename CharT,typename Allocator=std::allocator<char>>
+    class basic_lazy_json
+    {
+    public:
+        using char_type = CharT;
+        using allocator_type = Allocator;
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+        using string_type = std::basic_string<CharT>;
+        using view_type = basic_lazy_json_view<CharT>;
+    private:
+        using entry_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<detail::lazy_json_entry>;
+
+        string_type owned_;
+        bool owning_{false};
+        const CharT* text_{nullptr};
+        std::vector<detail::lazy_json_entry,entry_allocator_type> entries_;
+
+        basic_lazy_json(const allocator_type& alloc)
+            : entries_(alloc)
+        {
+        }
+    public:
+        basic_lazy_json(const basic_lazy_json&) = delete;
+
+        basic_lazy_json(basic_lazy_json&& other) noexcept
+            : owned_(std::move(other.owned_)), owning_(other.owning_),
+              text_(owning_ ? owned_.data() : other.text_), entries_(std::move(other.entries_))
+        {
+        }
+
+        basic_lazy_json& operator=(const basic_lazy_json&) = delete;
+
+        basic_lazy_json& operator=(basic_lazy_json&& other) noexcept
+        {
+            if (this != &other)
+            {
+                owned_ = std::move(other.owned_);
+                owning_ = other.owning_;
+                text_ = owning_ ? owned_.data() : other.text_;
+                entries_ = std::move(other.entries_);
+            }
+            return *this;
+        }
+
+        // Indexes s, which must outlive the document
+        static basic_lazy_json parse(const string_view_type& s,
+            const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>(),
+            const allocator_type& alloc = allocator_type())
+        {
+            basic_lazy_json doc(alloc);
+            doc.text_ = s.data();
+            doc.build(s.size(), options);
+            return doc;
+        }
+
+        // Takes ownership of s
+        static basic_lazy_json parse(string_type&& s,
+            const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>(),
+            const allocator_type& alloc = allocator_type())
+        {
+            basic_lazy_json doc(alloc);
+            doc.owned_ = std::move(s);
+            doc.owning_ = true;
+            doc.text_ = doc.owned_.data();
+            doc.build(doc.owned_.size(), options);
+            return doc;
+        }
+
+        view_type root() const noexcept
+        {
+            return view_type(text_, entries_.data(), 0);
+        }
+
+        json_type type() const noexcept
+        {
+            return root().type();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return root().size();
+        }
+
+        bool contains(const string_view_type& key) const noexcept
+        {
+            return root().contains(key);
+        }
+
+        view_type at(const string_view_type& key) const
+        {
+            return root().at(key);
+        }
+
+        view_type at(std::size_t i) const
+        {
+            return root().at(i);
+        }
+
+        view_type operator[](const string_view_type& key) const
+        {
+            return root().at(key);
+        }
+
+        view_type operator[](std::size_t i) const
+        {
+            return root().at(i);
+        }
+
+        template <typename T>
+        T as() const
+        {
+            return root().template as<T>();
+        }
+
+        // Number of values and keys in the structural index
+        std::size_t index_size() const noexcept
+        {
+            return entries_.size();
+        }
+
+        allocator_type get_allocator() const
+        {
+            return entries_.get_allocator();
+        }
+
+    private:
+        void build(std::size_t length, const basic_json_decode_options<CharT>& options)
+        {
+            std::error_code ec;
+            detail::lazy_json_indexer<CharT,entry_allocator_type> indexer(text_, length,
+                static_cast<std::size_t>(options.max_nesting_depth()), entries_);
+            indexer.run(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                std::size_t line = 1;
+                std::size_t column = 1;
+                for (std::size_t i = 0; i < indexer.position() && i < length; ++i)
+                {
+                    if (text_[i] == '\n')
+                    {
+                        ++line;
+                        column = 1;
+                    }
+                    else
+                    {
+                        ++column;
+                    }
+                }
+                JSONCONS_THROW(ser_error(ec, line, column));
+            }
+        }
+    };
+
+    using lazy_json = basic_lazy_json<char>;
+    using wlazy_json = basic_lazy_json<wchar_t>;
+    using lazy_json_view = basic_lazy_json_view<char>;
+    using wlazy_json_view = basic_lazy_json_view<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_LAZY_JSON_HPP
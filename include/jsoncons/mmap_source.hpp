@@ -0,0 +1,433 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MMAP_SOURCE_HPP
+#define JSONCONS_MMAP_SOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring> // std::memcpy
+#include <limits>
+#include <string>
+#include <utility> // std::swap
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+#if !defined(JSONCONS_NO_MMAP) && (defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)))
+#define JSONCONS_HAS_MMAP 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace jsoncons {
+
+    struct file_path_arg_t {explicit file_path_arg_t() = default; };
+    JSONCONS_INLINE_CONSTEXPR file_path_arg_t file_path_arg{};
+
+namespace detail {
+
+    // A file opened for reading. Regular files are memory mapped where the
+    // platform supports it, anything else (pipes, character devices, files
+    // reporting a size of zero) is read through a buffer.
+
+    class mapped_file
+    {
+#if defined(JSONCONS_HAS_MMAP)
+        int fd_{-1};
+#else
+        std::FILE* fp_{nullptr};
+#endif
+        void* map_data_{nullptr};
+        std::size_t map_size_{0};
+        bool error_{false};
+        bool eof_{false};
+    public:
+        mapped_file() noexcept
+            : eof_(true)
+        {
+        }
+
+        explicit mapped_file(const char* path)
+        {
+            open(path);
+        }
+
+        mapped_file(const mapped_file&) = delete;
+
+        mapped_file(mapped_file&& other) noexcept
+            : eof_(true)
+        {
+            swap(other);
+        }
+
+        ~mapped_file() noexcept
+        {
+            close();
+        }
+
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        mapped_file& operator=(mapped_file&& other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                swap(other);
+            }
+            return *this;
+        }
+
+        void swap(mapped_file& other) noexcept
+        {
+#if defined(JSONCONS_HAS_MMAP)
+            std::swap(fd_, other.fd_);
+#else
+            std::swap(fp_, other.fp_);
+#endif
+            std::swap(map_data_, other.map_data_);
+            std::swap(map_size_, other.map_size_);
+            std::swap(error_, other.error_);
+            std::swap(eof_, other.eof_);
+        }
+
+        bool is_mapped() const noexcept
+        {
+            return map_data_ != nullptr;
+        }
+
+        const uint8_t* data() const noexcept
+        {
+            return static_cast<const uint8_t*>(map_data_);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return map_size_;
+        }
+
+        bool is_error() const noexcept
+        {
+            return error_;
+        }
+
+        bool eof() const noexcept
+        {
+            return eof_;
+        }
+
+        // Reads up to length bytes when the file is not mapped, returns 0 at end of file or on error
+        std::size_t read(void* p, std::size_t length) noexcept
+        {
+            if (eof_ || length == 0)
+            {
+                return 0;
+            }
+#if defined(JSONCONS_HAS_MMAP)
+            while (true)
+            {
+                ::ssize_t count = ::read(fd_, p, length);
+                if (count > 0)
+                {
+                    return static_cast<std::size_t>(count);
+                }
+                if (count < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (count < 0)
+                {
+                    error_ = true;
+                }
+                eof_ = true;
+                return 0;
+            }
+#else
+            std::size_t count = std::fread(p, 1, length, fp_);
+            if (count < length)
+            {
+                if (std::ferror(fp_))
+                {
+                    error_ = true;
+                }
+                eof_ = true;
+            }
+            return count;
+#endif
+        }
+
+    private:
+        void open(const char* path) noexcept
+        {
+#if defined(JSONCONS_HAS_MMAP)
+            int flags = O_RDONLY;
+#if defined(O_CLOEXEC)
+            flags |= O_CLOEXEC;
+#endif
+            do
+            {
+                fd_ = ::open(path, flags);
+            } while (fd_ == -1 && errno == EINTR);
+            if (fd_ == -1)
+            {
+                error_ = true;
+                eof_ = true;
+                return;
+            }
+            struct ::stat st;
+            if (::fstat(fd_, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+                static_cast<uint64_t>(st.st_size) <= static_cast<uint64_t>((std::numeric_limits<std::size_t>::max)()))
+            {
+                const std::size_t size = static_cast<std::size_t>(st.st_size);
+                void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd_, 0);
+                if (data != MAP_FAILED)
+                {
+#if defined(MADV_SEQUENTIAL)
+                    ::madvise(data, size, MADV_SEQUENTIAL);
+#endif
+                    map_data_ = data;
+                    map_size_ = size;
+                    eof_ = true;
+                    return;
+                }
+            }
+#if defined(POSIX_FADV_SEQUENTIAL)
+            ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+#else
+            fp_ = std::fopen(path, "rb");
+            if (fp_ == nullptr)
+            {
+                error_ = true;
+                eof_ = true;
+            }
+#endif
+        }
+
+        void close() noexcept
+        {
+#if defined(JSONCONS_HAS_MMAP)
+            if (map_data_ != nullptr)
+            {
+                ::munmap(map_data_, map_size_);
+            }
+            if (fd_ != -1)
+            {
+                ::close(fd_);
+            }
+            fd_ = -1;
+#else
+            if (fp_ != nullptr)
+            {
+                std::fclose(fp_);
+            }
+            fp_ = nullptr;
+#endif
+            map_data_ = nullptr;
+            map_size_ = 0;
+        }
+    };
+
+} // namespace detail
+
+    // Reads a file by path. A regular file is mapped read-only and handed out
+    // whole by the first call to read_buffer, other files are read in chunks.
+
+    template <typename CharT>
+    class mmap_source
+    {
+        static_assert(sizeof(CharT) == 1, "mmap_source requires a single byte character type");
+    public:
+        using value_type = CharT;
+        static constexpr std::size_t default_max_buffer_size = 16384;
+    private:
+        detail::mapped_file file_;
+        std::vector<value_type> buffer_;
+        const value_type* data_{nullptr};
+        std::size_t length_{0};
+        std::size_t position_{0};
+    public:
+        mmap_source() = default;
+
+        explicit mmap_source(const char* path, std::size_t buf_size = default_max_buffer_size)
+            : file_(path)
+        {
+            if (file_.is_mapped())
+            {
+                data_ = reinterpret_cast<const value_type*>(file_.data());
+                length_ = file_.size();
+            }
+            else
+            {
+                buffer_.resize(buf_size > 0 ? buf_size : 1);
+            }
+        }
+
+        explicit mmap_source(const std::string& path, std::size_t buf_size = default_max_buffer_size)
+            : mmap_source(path.c_str(), buf_size)
+        {
+        }
+
+        // Noncopyable
+        mmap_source(const mmap_source&) = delete;
+
+        mmap_source(mmap_source&& other) noexcept
+            : file_(std::move(other.file_)),
+              buffer_(std::move(other.buffer_)),
+              data_(other.data_), length_(other.length_), position_(other.position_)
+        {
+            other.data_ = nullptr;
+            other.length_ = 0;
+            other.position_ = 0;
+        }
+
+        ~mmap_source() = default;
+
+        mmap_source& operator=(const mmap_source&) = delete;
+
+        mmap_source& operator=(mmap_source&& other) noexcept
+        {
+            file_ = std::move(other.file_);
+            buffer_ = std::move(other.buffer_);
+            data_ = other.data_;
+            length_ = other.length_;
+            position_ = other.position_;
+            other.data_ = nullptr;
+            other.length_ = 0;
+            other.position_ = 0;
+            return *this;
+        }
+
+        bool is_mapped() const
+        {
+            return file_.is_mapped();
+        }
+
+        bool eof() const
+        {
+            return length_ == 0 && (file_.is_mapped() || file_.eof());
+        }
+
+        bool is_error() const
+        {
+            return file_.is_error();
+        }
+
+        std::size_t position() const
+        {
+            return position_;
+        }
+
+        void ignore(std::size_t length)
+        {
+            std::size_t len = 0;
+            while (len < length)
+            {
+                if (length_ == 0)
+                {
+                    fill_buffer();
+                    if (length_ == 0)
+                    {
+                        break;
+                    }
+                }
+                std::size_t len2 = (std::min)(length_, length-len);
+                data_ += len2;
+                length_ -= len2;
+                position_ += len2;
+                len += len2;
+            }
+        }
+
+        char_result<value_type> peek()
+        {
+            if (length_ == 0)
+            {
+                fill_buffer();
+            }
+            if (length_ > 0)
+            {
+                value_type c = *data_;
+                return char_result<value_type>{c, false};
+            }
+            else
+            {
+                return char_result<value_type>{0, true};
+            }
+        }
+
+        span<const value_type> read_buffer()
+        {
+            if (length_ == 0)
+            {
+                fill_buffer();
+            }
+            const value_type* data = data_;
+            std::size_t length = length_;
+            data_ += length_;
+            position_ += length_;
+            length_ = 0;
+
+            return span<const value_type>(data, length);
+        }
+
+        std::size_t read(value_type* p, std::size_t length)
+        {
+            std::size_t len = 0;
+            while (len < length)
+            {
+                if (length_ == 0)
+                {
+                    if (!file_.is_mapped() && length - len >= buffer_.size())
+                    {
+                        // Large reads bypass the buffer
+                        std::size_t len2 = file_.read(p+len, length-len);
+                        if (len2 == 0)
+                        {
+                            break;
+                        }
+                        position_ += len2;
+                        len += len2;
+                        continue;
+                    }
+                    fill_buffer();
+                    if (length_ == 0)
+                    {
+                        break;
+                    }
+                }
+                std::size_t len2 = (std::min)(length_, length-len);
+                std::memcpy(p+len, data_, len2);
+                data_ += len2;
+                length_ -= len2;
+                position_ += len2;
+                len += len2;
+            }
+            return len;
+        }
+    private:
+        void fill_buffer()
+        {
+            if (file_.is_mapped() || buffer_.empty())
+            {
+                return;
+            }
+            length_ = file_.read(buffer_.data(), buffer_.size());
+            data_ = buffer_.data();
+        }
+    };
+
+    using binary_mmap_source = mmap_source<uint8_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_MMAP_SOURCE_HPP
@@ -726,6 +726,50 @@ struct decode_traits<T,
     }
 };
 
+namespace detail {
+
+    template <typename T>
+    using typed_array_element_type_t = decltype(jsoncons::detail::typed_array_element<T>::type);
+
+    template <typename T,typename Enable=void>
+    struct is_typed_array_vector : std::false_type {};
+
+    template <typename T,typename Alloc>
+    struct is_typed_array_vector<std::vector<T,Alloc>,
+        typename std::enable_if<ext_traits::is_detected<typed_array_element_type_t,T>::value>::type> : std::true_type {};
+
+} // namespace detail
+
+// Decodes T from a binary format cursor. A typed array with matching elements is 
+// copied into a vector in bulk with the cursor's read_typed_array, anything else 
+// goes through decode_traits
+
+template <typename T,typename Cursor,typename Alloc,typename TempAlloc>
+typename std::enable_if<!detail::is_typed_array_vector<T>::value,read_result<T>>::type
+try_decode_from_cursor(const allocator_set<Alloc,TempAlloc>& aset, Cursor& cursor)
+{
+    return decode_traits<T>::try_decode(aset, cursor);
+}
+
+template <typename T,typename Cursor,typename Alloc,typename TempAlloc>
+typename std::enable_if<detail::is_typed_array_vector<T>::value,read_result<T>>::type
+try_decode_from_cursor(const allocator_set<Alloc,TempAlloc>& aset, Cursor& cursor)
+{
+    using result_type = read_result<T>;
+
+    T v = jsoncons::make_obj_using_allocator<T>(aset.get_allocator());
+    std::error_code ec;
+    if (cursor.read_typed_array(v, ec))
+    {
+        return result_type{std::move(v)};
+    }
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
+    }
+    return decode_traits<T>::try_decode(aset, cursor);
+}
+
 } // namespace reflect
 } // namespace jsoncons
 
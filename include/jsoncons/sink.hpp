@@ -7,11 +7,16 @@
 #ifndef JSONCONS_SINK_HPP
 #define JSONCONS_SINK_HPP
 
+#include <algorithm> // std::min
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstring> // std::memcpy
+#include <iterator> // std::next
 #include <memory> // std::addressof
 #include <ostream>
+#include <type_traits>
+#include <utility> // std::declval
 #include <vector>
 
 #include <jsoncons/config/jsoncons_config.hpp>
@@ -120,6 +125,7 @@ namespace jsoncons {
         uint8_t * begin_buffer_;
         const uint8_t* end_buffer_;
         uint8_t* p_;
+        std::size_t flushed_{0};
 
     public:
 
@@ -156,6 +162,7 @@ namespace jsoncons {
         void flush()
         {
             stream_ptr_->write((char*)begin_buffer_, buffer_length());
+            flushed_ += buffer_length();
             p_ = buffer_.data();
         }
 
@@ -171,6 +178,7 @@ namespace jsoncons {
             {
                 stream_ptr_->write((char*)begin_buffer_, buffer_length());
                 stream_ptr_->write((const char*)s,length);
+                flushed_ += buffer_length() + length;
                 p_ = begin_buffer_;
             }
         }
@@ -184,10 +192,46 @@ namespace jsoncons {
             else
             {
                 stream_ptr_->write((char*)begin_buffer_, buffer_length());
+                flushed_ += buffer_length();
                 p_ = begin_buffer_;
                 push_back(ch);
             }
         }
+
+        // Number of bytes written through this sink
+        std::size_t position() const
+        {
+            return flushed_ + buffer_length();
+        }
+
+        // True if bytes already passed to the stream can be overwritten
+        bool is_seekable() const
+        {
+            return stream_ptr_->tellp() != std::basic_ostream<char>::pos_type(-1);
+        }
+
+        // Overwrites length bytes starting at pos, a position previously returned by position().
+        // Bytes that have already been passed to the stream are overwritten by seeking back,
+        // which requires is_seekable()
+        void write_at(std::size_t pos, const uint8_t* s, std::size_t length)
+        {
+            JSONCONS_ASSERT(pos + length <= position());
+            if (pos < flushed_)
+            {
+                std::size_t n = (std::min)(length, flushed_ - pos);
+                auto end = stream_ptr_->tellp();
+                stream_ptr_->seekp(end - static_cast<std::streamoff>(flushed_ - pos));
+                stream_ptr_->write((const char*)s, n);
+                stream_ptr_->seekp(end);
+                pos += n;
+                s += n;
+                length -= n;
+            }
+            if (length > 0)
+            {
+                std::memcpy(begin_buffer_ + (pos - flushed_), s, length);
+            }
+        }
     private:
 
         std::size_t buffer_length() const
@@ -263,6 +307,7 @@ namespace jsoncons {
         using value_type = typename Container::value_type;
     private:
         container_type* buf_ptr;
+        std::size_t base_;
     public:
 
         // Noncopyable
@@ -271,7 +316,7 @@ namespace jsoncons {
         bytes_sink(bytes_sink&&) = default;
 
         bytes_sink(container_type& buf)
-            : buf_ptr(std::addressof(buf))
+            : buf_ptr(std::addressof(buf)), base_(buf.size())
         {
         }
         
@@ -288,8 +333,73 @@ namespace jsoncons {
         {
             buf_ptr->push_back(static_cast<value_type>(ch));
         }
+
+        void append(const uint8_t* s, std::size_t length)
+        {
+            append(s, length, std::integral_constant<bool, std::is_same<value_type,uint8_t>::value &&
+                ext_traits::is_detected<container_range_insert_t,Container>::value>());
+        }
+
+        // Number of bytes written through this sink
+        std::size_t position() const
+        {
+            return buf_ptr->size() - base_;
+        }
+
+        bool is_seekable() const
+        {
+            return true;
+        }
+
+        // Overwrites length bytes starting at pos, a position previously returned by position()
+        void write_at(std::size_t pos, const uint8_t* s, std::size_t length)
+        {
+            JSONCONS_ASSERT(pos + length <= position());
+            auto it = std::next(buf_ptr->begin(), base_ + pos);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                *it++ = static_cast<value_type>(s[i]);
+            }
+        }
+    private:
+        template <typename C>
+        using container_range_insert_t = decltype(std::declval<C&>().insert(std::declval<C&>().end(), 
+            std::declval<const uint8_t*>(), std::declval<const uint8_t*>()));
+
+        void append(const uint8_t* s, std::size_t length, std::true_type)
+        {
+            buf_ptr->insert(buf_ptr->end(), s, s + length);
+        }
+
+        void append(const uint8_t* s, std::size_t length, std::false_type)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                buf_ptr->push_back(static_cast<value_type>(s[i]));
+            }
+        }
     };
 
+    namespace ext_traits {
+
+        template <typename Sink>
+        using sink_append_t = decltype(std::declval<Sink&>().append(std::declval<const uint8_t*>(), std::size_t()));
+
+        // has_sink_append
+
+        template <typename Sink>
+        struct has_sink_append : std::integral_constant<bool, is_detected<sink_append_t, Sink>::value> {};
+
+        template <typename Sink>
+        using sink_write_at_t = decltype(std::declval<Sink&>().write_at(std::size_t(), std::declval<const uint8_t*>(), std::size_t()));
+
+        // is_seekable_sink
+
+        template <typename Sink>
+        using is_seekable_sink = is_detected<sink_write_at_t, Sink>;
+
+    } // namespace ext_traits
+
 } // namespace jsoncons
 
 #endif // JSONCONS_SINK_HPP
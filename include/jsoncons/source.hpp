@@ -7,6 +7,7 @@
 #ifndef JSONCONS_SOURCE_HPP
 #define JSONCONS_SOURCE_HPP
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring> // std::memcpy
 #include <exception>
@@ -480,16 +481,8 @@ namespace jsoncons {
         {
             std::size_t count = (std::min)(length, static_cast<std::size_t>(std::distance(current_, end_)));
 
-            //JSONCONS_COPY(current_, current_ + count, data);
-
-            auto end = current_ + count;
-            value_type* p = data;
-            while (current_ != end)
-            {
-                *p++ = *current_++;
-            }
-
-            //current_ += count;
+            std::copy(current_, current_ + count, data);
+            current_ += count;
             position_ += count;
 
             return count;
@@ -686,16 +679,12 @@ namespace jsoncons {
         read(value_type* data, std::size_t length)
         {
             std::size_t count = (std::min)(length, static_cast<std::size_t>(std::distance(current_, end_)));
-            //JSONCONS_COPY(current_, current_ + count, data);
-
             auto end = current_ + count;
             value_type* p = data;
             while (current_ != end)
             {
                 *p++ = *current_++;
             }
-
-            //current_ += count;
             position_ += count;
 
             return count;
@@ -14,6 +14,7 @@
 #include <ios>
 #include <memory> // std::allocator
 #include <system_error>
+#include <vector>
 
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/allocator_set.hpp>
@@ -33,6 +34,55 @@ namespace jsoncons {
 
 // basic_staj_visitor
 
+namespace detail {
+
+    template <typename T>
+    struct typed_array_element {};
+
+    template <>
+    struct typed_array_element<uint8_t> {static constexpr typed_array_type type = typed_array_type::uint8_value;};
+    template <>
+    struct typed_array_element<uint16_t> {static constexpr typed_array_type type = typed_array_type::uint16_value;};
+    template <>
+    struct typed_array_element<uint32_t> {static constexpr typed_array_type type = typed_array_type::uint32_value;};
+    template <>
+    struct typed_array_element<uint64_t> {static constexpr typed_array_type type = typed_array_type::uint64_value;};
+    template <>
+    struct typed_array_element<int8_t> {static constexpr typed_array_type type = typed_array_type::int8_value;};
+    template <>
+    struct typed_array_element<int16_t> {static constexpr typed_array_type type = typed_array_type::int16_value;};
+    template <>
+    struct typed_array_element<int32_t> {static constexpr typed_array_type type = typed_array_type::int32_value;};
+    template <>
+    struct typed_array_element<int64_t> {static constexpr typed_array_type type = typed_array_type::int64_value;};
+    template <>
+    struct typed_array_element<float> {static constexpr typed_array_type type = typed_array_type::float_value;};
+    template <>
+    struct typed_array_element<double> {static constexpr typed_array_type type = typed_array_type::double_value;};
+
+    // Receives a typed array whose elements are T and copies it into a vector in one go
+    template <typename CharT,typename T,typename Alloc>
+    class typed_array_collector : public basic_default_json_visitor<CharT>
+    {
+        std::vector<T,Alloc>* v_;
+    public:
+        typed_array_collector(std::vector<T,Alloc>& v)
+            : v_(std::addressof(v))
+        {
+        }
+    private:
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const T>& s, 
+            semantic_tag,
+            const ser_context&,
+            std::error_code&) override
+        {
+            v_->assign(s.begin(), s.end());
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+} // namespace detail
+
 enum class staj_cursor_state
 {
     typed_array = 1,
@@ -103,6 +153,11 @@ public:
         return data_.type() != typed_array_type();
     }
 
+    const typed_array_view& typed_array_data() const
+    {
+        return data_;
+    }
+
     staj_cursor_state state() const
     {
         return state_;
@@ -210,6 +265,21 @@ public:
         }
     }
 
+    // If the current event begins a typed array whose elements are T, copies the elements 
+    // into v and returns true, otherwise returns false
+    template <typename T,typename Alloc>
+    bool read_typed_array(std::vector<T,Alloc>& v, const ser_context& context, std::error_code& ec)
+    {
+        if (event_.event_type() != staj_event_type::begin_array || !is_typed_array() ||
+            data_.type() != detail::typed_array_element<T>::type)
+        {
+            return false;
+        }
+        detail::typed_array_collector<CharT,T,Alloc> collector(v);
+        dump(collector, context, ec);
+        return !ec;
+    }
+
     void dump(basic_json_visitor<CharT>& visitor, const ser_context& context, std::error_code& ec)
     {
         if (is_typed_array())
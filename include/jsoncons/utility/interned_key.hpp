@@ -0,0 +1,514 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_UTILITY_INTERNED_KEY_HPP
+#define JSONCONS_UTILITY_INTERNED_KEY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <iterator>
+#include <memory> // std::allocator
+#include <new>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+namespace jsoncons {
+namespace utility {
+
+    // An immutable, reference counted string used as an object member key. Copies
+    // share one allocation, and keys handed out by the same interned_key_pool are equal
+    // exactly when they point to the same allocation.
+
+    template <typename CharT,typename CharTraits = std::char_traits<CharT>,typename Allocator = std::allocator<CharT>>
+    class basic_interned_key
+    {
+    public:
+        using value_type = CharT;
+        using traits_type = CharTraits;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using const_iterator = const CharT*;
+        using iterator = const_iterator;
+        using string_view_type = jsoncons::basic_string_view<CharT,CharTraits>;
+    private:
+        struct rep
+        {
+            std::atomic<std::size_t> refs;
+            std::size_t length;
+            std::size_t block_count;
+            allocator_type alloc;
+
+            rep(std::size_t len, std::size_t count, const allocator_type& a)
+                : refs(1), length(len), block_count(count), alloc(a)
+            {
+            }
+
+            CharT* chars() noexcept
+            {
+                return reinterpret_cast<CharT*>(this + 1);
+            }
+        };
+
+        using rep_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<rep>;
+        using rep_pointer = typename std::allocator_traits<rep_allocator_type>::pointer;
+
+        rep* ptr_{nullptr};
+
+    public:
+        basic_interned_key() noexcept = default;
+
+        explicit basic_interned_key(const allocator_type&) noexcept
+        {
+        }
+
+        basic_interned_key(const CharT* s, std::size_t length, const allocator_type& alloc = allocator_type())
+            : ptr_(create(s, length, alloc))
+        {
+        }
+
+        basic_interned_key(const CharT* s, const allocator_type& alloc = allocator_type())
+            : ptr_(create(s, CharTraits::length(s), alloc))
+        {
+        }
+
+        template <typename InputIt,
+                  typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        basic_interned_key(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+            : ptr_(nullptr)
+        {
+            std::basic_string<CharT,CharTraits> s(first, last);
+            ptr_ = create(s.data(), s.size(), alloc);
+        }
+
+        template <typename Tr,typename Alloc>
+        explicit basic_interned_key(const std::basic_string<CharT,Tr,Alloc>& s, const allocator_type& alloc = allocator_type())
+            : ptr_(create(s.data(), s.size(), alloc))
+        {
+        }
+
+        basic_interned_key(const basic_interned_key& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            add_ref();
+        }
+
+        basic_interned_key(const basic_interned_key& other, const allocator_type&) noexcept
+            : ptr_(other.ptr_)
+        {
+            add_ref();
+        }
+
+        basic_interned_key(basic_interned_key&& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            other.ptr_ = nullptr;
+        }
+
+        basic_interned_key(basic_interned_key&& other, const allocator_type&) noexcept
+            : ptr_(other.ptr_)
+        {
+            other.ptr_ = nullptr;
+        }
+
+        ~basic_interned_key() noexcept
+        {
+            release();
+        }
+
+        basic_interned_key& operator=(const basic_interned_key& other) noexcept
+        {
+            basic_interned_key(other).swap(*this);
+            return *this;
+        }
+
+        basic_interned_key& operator=(basic_interned_key&& other) noexcept
+        {
+            basic_interned_key(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        void swap(basic_interned_key& other) noexcept
+        {
+            std::swap(ptr_, other.ptr_);
+        }
+
+        const CharT* data() const noexcept
+        {
+            return ptr_ != nullptr ? ptr_->chars() : empty_chars();
+        }
+
+        const CharT* c_str() const noexcept
+        {
+            return data();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return ptr_ != nullptr ? ptr_->length : 0;
+        }
+
+        std::size_t length() const noexcept
+        {
+            return size();
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data() + size();
+        }
+
+        const CharT& operator[](std::size_t i) const noexcept
+        {
+            return data()[i];
+        }
+
+        allocator_type get_allocator() const
+        {
+            return ptr_ != nullptr ? ptr_->alloc : allocator_type();
+        }
+
+        // Keys are immutable
+        void shrink_to_fit() noexcept
+        {
+        }
+
+        // Number of keys sharing this allocation, 0 for an empty key
+        std::size_t use_count() const noexcept
+        {
+            return ptr_ != nullptr ? ptr_->refs.load(std::memory_order_relaxed) : 0;
+        }
+
+        bool shares_with(const basic_interned_key& other) const noexcept
+        {
+            return ptr_ == other.ptr_;
+        }
+
+        operator string_view_type() const noexcept
+        {
+            return string_view_type(data(), size());
+        }
+
+        int compare(const basic_interned_key& other) const noexcept
+        {
+            return ptr_ == other.ptr_ ? 0 : compare(other.data(), other.size());
+        }
+
+        int compare(const string_view_type& s) const noexcept
+        {
+            return compare(s.data(), s.size());
+        }
+
+        int compare(const CharT* s) const noexcept
+        {
+            return compare(s, CharTraits::length(s));
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.ptr_ == rhs.ptr_ || (lhs.size() == rhs.size() && CharTraits::compare(lhs.data(), rhs.data(), lhs.size()) == 0);
+        }
+
+        friend bool operator!=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+
+        friend bool operator<=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) <= 0;
+        }
+
+        friend bool operator>(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) > 0;
+        }
+
+        friend bool operator>=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) >= 0;
+        }
+
+        // Comparisons with string views, std::basic_string and null terminated strings
+
+        template <typename T>
+        friend typename std::enable_if<std::is_convertible<const T&,string_view_type>::value,bool>::type
+        operator==(const basic_interned_key& lhs, const T& rhs) noexcept
+        {
+            return lhs.compare(string_view_type(rhs)) == 0;
+        }
+
+        template <typename T>
+        friend typename std::enable_if<std::is_convertible<const T&,string_view_type>::value,bool>::type
+        operator==(const T& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(string_view_type(lhs)) == 0;
+        }
+
+        template <typename T>
+        friend typename std::enable_if<std::is_convertible<const T&,string_view_type>::value,bool>::type
+        operator!=(const basic_interned_key& lhs, const T& rhs) noexcept
+        {
+            return lhs.compare(string_view_type(rhs)) != 0;
+        }
+
+        template <typename T>
+        friend typename std::enable_if<std::is_convertible<const T&,string_view_type>::value,bool>::type
+        operator!=(const T& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(string_view_type(lhs)) != 0;
+        }
+
+        template <typename T>
+        friend typename std::enable_if<std::is_convertible<const T&,string_view_type>::value,bool>::type
+        operator<(const basic_interned_key& lhs, const T& rhs) noexcept
+        {
+            return lhs.compare(string_view_type(rhs)) < 0;
+        }
+
+        template <typename T>
+        friend typename std::enable_if<std::is_convertible<const T&,string_view_type>::value,bool>::type
+        operator<(const T& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(string_view_type(lhs)) > 0;
+        }
+
+        friend std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, const basic_interned_key& key)
+        {
+            os.write(key.data(), static_cast<std::streamsize>(key.size()));
+            return os;
+        }
+
+    private:
+        static const CharT* empty_chars() noexcept
+        {
+            static const CharT empty[1] = {CharT()};
+            return empty;
+        }
+
+        int compare(const CharT* s, std::size_t length) const noexcept
+        {
+            const std::size_t len = size();
+            const std::size_t n = len < length ? len : length;
+            int result = CharTraits::compare(data(), s, n);
+            if (result != 0)
+            {
+                return result;
+            }
+            return len < length ? -1 : (len > length ? 1 : 0);
+        }
+
+        static rep* create(const CharT* s, std::size_t length, const allocator_type& alloc)
+        {
+            if (length == 0)
+            {
+                return nullptr;
+            }
+            // One rep for the header, followed by room for the characters and a terminating null
+            const std::size_t count = 1 + ((length + 1)*sizeof(CharT) + sizeof(rep) - 1) / sizeof(rep);
+            rep_allocator_type rep_alloc(alloc);
+            rep* p = ext_traits::to_plain_pointer(std::allocator_traits<rep_allocator_type>::allocate(rep_alloc, count));
+            ::new(static_cast<void*>(p)) rep(length, count, alloc);
+            CharT* chars = p->chars();
+            std::memcpy(chars, s, length*sizeof(CharT));
+            chars[length] = CharT();
+            return p;
+        }
+
+        void add_ref() noexcept
+        {
+            if (ptr_ != nullptr)
+            {
+                ptr_->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void release() noexcept
+        {
+            if (ptr_ != nullptr && ptr_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                rep_allocator_type rep_alloc(ptr_->alloc);
+                const std::size_t count = ptr_->block_count;
+                ptr_->~rep();
+                std::allocator_traits<rep_allocator_type>::deallocate(rep_alloc,
+                    std::pointer_traits<rep_pointer>::pointer_to(*ptr_), count);
+            }
+            ptr_ = nullptr;
+        }
+    };
+
+    template <typename T>
+    struct is_interned_key : std::false_type {};
+
+    template <typename CharT,typename CharTraits,typename Allocator>
+    struct is_interned_key<basic_interned_key<CharT,CharTraits,Allocator>> : std::true_type {};
+
+    // Hands out one shared basic_interned_key per distinct string. Open addressing
+    // with linear probing, grown when half full.
+
+    template <typename KeyT>
+    class interned_key_pool
+    {
+    public:
+        using key_type = KeyT;
+        using char_type = typename KeyT::value_type;
+        using allocator_type = typename KeyT::allocator_type;
+    private:
+        struct entry
+        {
+            std::size_t hash;
+            key_type key;
+        };
+        using entry_allocator_type = typename std::allocator_traits<allocator_type>::template rebind_alloc<entry>;
+
+        std::vector<entry,entry_allocator_type> slots_;
+        std::size_t count_{0};
+        allocator_type alloc_;
+    public:
+        explicit interned_key_pool(const allocator_type& alloc = allocator_type())
+            : slots_(entry_allocator_type(alloc)), alloc_(alloc)
+        {
+        }
+
+        std::size_t size() const noexcept
+        {
+            return count_;
+        }
+
+        void clear() noexcept
+        {
+            slots_.clear();
+            count_ = 0;
+        }
+
+        key_type get(const char_type* s, std::size_t length)
+        {
+            if (length == 0)
+            {
+                return key_type();
+            }
+            if (2*(count_ + 1) > slots_.size())
+            {
+                grow();
+            }
+            const std::size_t hash = hash_chars(s, length);
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t i = hash & mask;
+            while (!slots_[i].key.empty())
+            {
+                const key_type& key = slots_[i].key;
+                if (slots_[i].hash == hash && key.size() == length &&
+                    std::char_traits<char_type>::compare(key.data(), s, length) == 0)
+                {
+                    return key;
+                }
+                i = (i + 1) & mask;
+            }
+            slots_[i].hash = hash;
+            slots_[i].key = key_type(s, length, alloc_);
+            ++count_;
+            return slots_[i].key;
+        }
+
+    private:
+        // FNV-1a
+        static std::size_t hash_chars(const char_type* s, std::size_t length) noexcept
+        {
+            using uchar_type = typename std::make_unsigned<char_type>::type;
+            uint64_t hash_value = 14695981039346656037ull;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                hash_value ^= static_cast<uchar_type>(s[i]);
+                hash_value *= 1099511628211ull;
+            }
+            return static_cast<std::size_t>(hash_value ^ (hash_value >> 32));
+        }
+
+        void grow()
+        {
+            std::size_t capacity = slots_.empty() ? 64 : 2*slots_.size();
+            std::vector<entry,entry_allocator_type> slots(capacity, entry{0, key_type()}, entry_allocator_type(alloc_));
+            const std::size_t mask = capacity - 1;
+            for (auto& item : slots_)
+            {
+                if (!item.key.empty())
+                {
+                    std::size_t i = item.hash & mask;
+                    while (!slots[i].key.empty())
+                    {
+                        i = (i + 1) & mask;
+                    }
+                    slots[i].hash = item.hash;
+                    slots[i].key = std::move(item.key);
+                }
+            }
+            slots_.swap(slots);
+        }
+    };
+
+    // Constructs keys directly, for key types other than basic_interned_key
+
+    template <typename KeyT>
+    class null_key_pool
+    {
+    public:
+        using key_type = KeyT;
+        using char_type = typename KeyT::value_type;
+        using allocator_type = typename KeyT::allocator_type;
+    private:
+        allocator_type alloc_;
+    public:
+        explicit null_key_pool(const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
+        {
+        }
+
+        std::size_t size() const noexcept
+        {
+            return 0;
+        }
+
+        void clear() noexcept
+        {
+        }
+
+        key_type get(const char_type* s, std::size_t length)
+        {
+            return key_type(s, length, alloc_);
+        }
+    };
+
+    template <typename KeyT>
+    using key_pool_t = typename std::conditional<is_interned_key<KeyT>::value,
+        interned_key_pool<KeyT>,null_key_pool<KeyT>>::type;
+
+} // namespace utility
+} // namespace jsoncons
+
+#endif // JSONCONS_UTILITY_INTERNED_KEY_HPP
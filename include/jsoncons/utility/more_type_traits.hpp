@@ -471,6 +471,10 @@ namespace ext_traits {
     using
     container_reserve_t = decltype(std::declval<Container>().reserve(typename Container::size_type()));
 
+    template <typename Container>
+    using
+    container_append_t = decltype(std::declval<Container>().append(std::declval<const typename Container::value_type*>(), std::size_t()));
+
     template <typename Container>
     using
     container_data_t = decltype(std::declval<Container>().data());
@@ -561,6 +565,12 @@ namespace ext_traits {
     using
     has_reserve = is_detected<container_reserve_t, Container>;
 
+    // has_append
+
+    template <typename Container>
+    using
+    has_append = is_detected<container_append_t, Container>;
+
     // is_back_insertable
 
     template <typename Container>
@@ -19,6 +19,7 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/eisel_lemire.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
@@ -749,6 +750,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val) 
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<char>{s+length};
+        }
         const char* cur = s+length;
         const auto res = std::from_chars(s, cur, val);
         if (JSONCONS_UNLIKELY(res.ptr != cur))
@@ -760,6 +765,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<wchar_t>{s+length};
+        }
         std::string buf(length,'0');
         for (size_t i = 0; i < length; ++i)
         {
@@ -778,6 +787,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val)
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<char>{s+length};
+        }
         static _locale_t locale = _create_locale(LC_NUMERIC, "C");
 
         const char* cur = s+length;
@@ -796,6 +809,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<wchar_t>{s+length};
+        }
         static _locale_t locale = _create_locale(LC_NUMERIC, "C");
 
         const wchar_t* cur = s+length;
@@ -817,6 +834,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val)
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<char>{s+length};
+        }
         locale_t locale = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
 
         const char* cur = s+length;
@@ -835,6 +856,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<wchar_t>{s+length};
+        }
         locale_t locale = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
 
         const wchar_t* cur = s+length;
@@ -855,6 +880,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val)
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<char>{s+length};
+        }
         const char* cur = s+length;
         char *end = nullptr;
         val = strtod(s, &end);
@@ -884,6 +913,10 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
     inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
     {
+        if (jsoncons::detail::try_decstr_to_double(s, length, val))
+        {
+            return to_number_result<wchar_t>{s+length};
+        }
         const wchar_t* cur = s+length;
         wchar_t *end = nullptr;
         val = wcstod(s, &end);
@@ -0,0 +1,1437 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_UTILITY_REGEX_HPP
+#define JSONCONS_UTILITY_REGEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+#if defined(JSONCONS_HAS_STD_REGEX)
+#include <regex>
+#endif
+
+// The maximum number of instructions in a compiled pattern, bounds the work done per input character
+#if !defined(JSONCONS_REGEX_MAX_PROGRAM_SIZE)
+#define JSONCONS_REGEX_MAX_PROGRAM_SIZE 50000
+#endif
+
+namespace jsoncons {
+
+    enum class regex_errc
+    {
+        success = 0,
+        unexpected_end = 1,
+        unmatched_parenthesis = 2,
+        unmatched_bracket = 3,
+        invalid_group = 4,
+        invalid_escape = 5,
+        invalid_range = 6,
+        invalid_quantifier = 7,
+        nothing_to_repeat = 8,
+        unsupported = 9,
+        too_large = 10,
+        invalid_pattern = 11
+    };
+
+    class regex_error_category_impl
+        : public std::error_category
+    {
+    public:
+        const char* name() const noexcept override
+        {
+            return "jsoncons/regex";
+        }
+        std::string message(int ev) const override
+        {
+            switch (static_cast<regex_errc>(ev))
+            {
+                case regex_errc::unexpected_end:
+                    return "Unexpected end of pattern";
+                case regex_errc::unmatched_parenthesis:
+                    return "Unmatched parenthesis";
+                case regex_errc::unmatched_bracket:
+                    return "Unmatched bracket";
+                case regex_errc::invalid_group:
+                    return "Invalid group";
+                case regex_errc::invalid_escape:
+                    return "Invalid escape";
+                case regex_errc::invalid_range:
+                    return "Range out of order in character class";
+                case regex_errc::invalid_quantifier:
+                    return "Numbers out of order in quantifier";
+                case regex_errc::nothing_to_repeat:
+                    return "Nothing to repeat";
+                case regex_errc::unsupported:
+                    return "Lookaround assertions, backreferences and unicode property escapes are not supported";
+                case regex_errc::too_large:
+                    return "Pattern too large";
+                case regex_errc::invalid_pattern:
+                    return "Invalid pattern";
+                default:
+                    return "Unknown regex error";
+            }
+        }
+    };
+
+    inline
+    const std::error_category& regex_error_category() noexcept
+    {
+        static regex_error_category_impl instance;
+        return instance;
+    }
+
+    inline
+    std::error_code make_error_code(regex_errc result) noexcept
+    {
+        return std::error_code(static_cast<int>(result), regex_error_category());
+    }
+
+} // namespace jsoncons
+
+namespace std {
+    template<>
+    struct is_error_code_enum<jsoncons::regex_errc> : public true_type
+    {
+    };
+} // namespace std
+
+namespace jsoncons {
+
+    enum class regex_options
+    {
+        none = 0,
+        icase = 1
+    };
+
+    // The interface implemented by regular expression backends
+    template <typename CharT>
+    class basic_regex_engine
+    {
+    public:
+        using char_type = CharT;
+
+        virtual ~basic_regex_engine() = default;
+
+        // Finds the leftmost match that starts at or after offset start of [data, data+length),
+        // and sets [first, last) to its offsets
+        virtual bool search(const char_type* data, std::size_t length, std::size_t start,
+            std::size_t& first, std::size_t& last) const = 0;
+
+        // Returns true if [data, data+length) contains a match
+        virtual bool contains(const char_type* data, std::size_t length) const = 0;
+    };
+
+namespace detail {
+
+    template <typename CharT, std::size_t Size = sizeof(CharT)>
+    struct regex_code_units
+    {
+        // UTF-32
+        static uint32_t next(const CharT* p, const CharT*, std::size_t& n)
+        {
+            n = 1;
+            return static_cast<uint32_t>(static_cast<typename std::make_unsigned<CharT>::type>(*p));
+        }
+    };
+
+    template <typename CharT>
+    struct regex_code_units<CharT,1>
+    {
+        // UTF-8, a byte that does not start a valid sequence is read as itself
+        static uint32_t next(const CharT* p, const CharT* end, std::size_t& n)
+        {
+            n = 1;
+            const uint32_t c = static_cast<uint8_t>(*p);
+            std::size_t length;
+            uint32_t cp;
+            if (c < 0x80)
+            {
+                return c;
+            }
+            else if ((c >> 5) == 0x06)
+            {
+                length = 2;
+                cp = c & 0x1f;
+            }
+            else if ((c >> 4) == 0x0e)
+            {
+                length = 3;
+                cp = c & 0x0f;
+            }
+            else if ((c >> 3) == 0x1e)
+            {
+                length = 4;
+                cp = c & 0x07;
+            }
+            else
+            {
+                return c;
+            }
+            if (static_cast<std::size_t>(end - p) < length)
+            {
+                return c;
+            }
+            for (std::size_t i = 1; i < length; ++i)
+            {
+                const uint32_t b = static_cast<uint8_t>(p[i]);
+                if ((b & 0xc0) != 0x80)
+                {
+                    return c;
+                }
+                cp = (cp << 6) | (b & 0x3f);
+            }
+            n = length;
+            return cp;
+        }
+    };
+
+    template <typename CharT>
+    struct regex_code_units<CharT,2>
+    {
+        // UTF-16, an unpaired surrogate is read as itself
+        static uint32_t next(const CharT* p, const CharT* end, std::size_t& n)
+        {
+            n = 1;
+            const uint32_t c = static_cast<uint16_t>(*p);
+            if (c >= 0xd800 && c <= 0xdbff && end - p > 1)
+            {
+                const uint32_t c2 = static_cast<uint16_t>(p[1]);
+                if (c2 >= 0xdc00 && c2 <= 0xdfff)
+                {
+                    n = 2;
+                    return 0x10000 + ((c - 0xd800) << 10) + (c2 - 0xdc00);
+                }
+            }
+            return c;
+        }
+    };
+
+    struct regex_char_class
+    {
+        using range_type = std::pair<uint32_t,uint32_t>;
+
+        std::vector<range_type> ranges;
+        bool negated{false};
+        uint64_t ascii[2] = {0, 0}; // membership of code points below 0x80, after negation
+
+        void add(uint32_t lo, uint32_t hi)
+        {
+            ranges.emplace_back(lo, hi);
+        }
+
+        void add(const std::vector<range_type>& other)
+        {
+            ranges.insert(ranges.end(), other.begin(), other.end());
+        }
+
+        void add_complement(std::vector<range_type> other)
+        {
+            normalize(other);
+            uint32_t next = 0;
+            for (const auto& r : other)
+            {
+                if (r.first > next)
+                {
+                    ranges.emplace_back(next, r.first - 1);
+                }
+                next = r.second + 1;
+            }
+            if (next <= 0x10ffff)
+            {
+                ranges.emplace_back(next, 0x10ffff);
+            }
+        }
+
+        // Makes the class case insensitive for ASCII letters, sorts and merges ranges
+        void finish(bool icase)
+        {
+            if (icase)
+            {
+                std::size_t count = ranges.size();
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const range_type r = ranges[i];
+                    if (r.first <= 'z' && r.second >= 'a')
+                    {
+                        ranges.emplace_back((std::max)(r.first, uint32_t('a')) - 32, (std::min)(r.second, uint32_t('z')) - 32);
+                    }
+                    if (r.first <= 'Z' && r.second >= 'A')
+                    {
+                        ranges.emplace_back((std::max)(r.first, uint32_t('A')) + 32, (std::min)(r.second, uint32_t('Z')) + 32);
+                    }
+                }
+            }
+            normalize(ranges);
+            for (uint32_t c = 0; c < 0x80; ++c)
+            {
+                if (search(c) != negated)
+                {
+                    ascii[c >> 6] |= uint64_t(1) << (c & 63);
+                }
+            }
+        }
+
+        bool contains(uint32_t c) const
+        {
+            if (c < 0x80)
+            {
+                return (ascii[c >> 6] >> (c & 63)) & 1;
+            }
+            return search(c) != negated;
+        }
+
+    private:
+        bool search(uint32_t c) const
+        {
+            auto it = std::upper_bound(ranges.begin(), ranges.end(), c,
+                [](uint32_t value, const range_type& r) {return value < r.first;});
+            return it != ranges.begin() && c <= (it-1)->second;
+        }
+
+        static void normalize(std::vector<range_type>& v)
+        {
+            if (v.empty())
+            {
+                return;
+            }
+            std::sort(v.begin(), v.end());
+            std::size_t last = 0;
+            for (std::size_t i = 1; i < v.size(); ++i)
+            {
+                if (v[i].first <= v[last].second + 1)
+                {
+                    v[last].second = (std::max)(v[last].second, v[i].second);
+                }
+                else
+                {
+                    v[++last] = v[i];
+                }
+            }
+            v.resize(last + 1);
+        }
+    };
+
+    enum class regex_opcode : uint8_t
+    {
+        character,
+        char_class,
+        split,
+        jump,
+        assert_begin,
+        assert_end,
+        word_boundary,
+        not_word_boundary,
+        match
+    };
+
+    struct regex_instruction
+    {
+        regex_opcode opcode;
+        uint32_t value; // code point or class index
+        std::size_t x;  // jump target, or preferred split target
+        std::size_t y;  // other split target
+
+        regex_instruction(regex_opcode opcode, uint32_t value = 0)
+            : opcode(opcode), value(value), x(0), y(0)
+        {
+        }
+    };
+
+    // Simulates the NFA of the pattern on all threads at once (Pike VM), so the time
+    // taken is linear in the length of the input for a given pattern
+    template <typename CharT>
+    class nfa_regex_engine : public basic_regex_engine<CharT>
+    {
+        using char_type = CharT;
+        using code_units = regex_code_units<CharT>;
+
+        struct vm_thread
+        {
+            std::size_t pc;
+            std::size_t start;
+        };
+
+        std::vector<regex_instruction> program_;
+        std::vector<regex_char_class> classes_;
+        bool anchored_;
+    public:
+        nfa_regex_engine(std::vector<regex_instruction>&& program, std::vector<regex_char_class>&& classes)
+            : program_(std::move(program)), classes_(std::move(classes)),
+              anchored_(program_.front().opcode == regex_opcode::assert_begin)
+        {
+        }
+
+        bool search(const char_type* data, std::size_t length, std::size_t start,
+            std::size_t& first, std::size_t& last) const override
+        {
+            return run(data, length, start, false, first, last);
+        }
+
+        bool contains(const char_type* data, std::size_t length) const override
+        {
+            std::size_t first = 0;
+            std::size_t last = 0;
+            return run(data, length, 0, true, first, last);
+        }
+
+    private:
+        static bool is_word_unit(char_type c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        }
+
+        // Follows jumps, splits and assertions from pc, in priority order, and appends the
+        // threads that wait on a character to list
+        void add_thread(std::vector<vm_thread>& list, std::vector<std::size_t>& marks, std::vector<std::size_t>& stack,
+            std::size_t pc, std::size_t start, const char_type* data, std::size_t length, std::size_t pos) const
+        {
+            const std::size_t id = pos + 1;
+            stack.push_back(pc);
+            while (!stack.empty())
+            {
+                pc = stack.back();
+                stack.pop_back();
+                if (marks[pc] == id)
+                {
+                    continue;
+                }
+                marks[pc] = id;
+                const regex_instruction& inst = program_[pc];
+                switch (inst.opcode)
+                {
+                    case regex_opcode::jump:
+                        stack.push_back(inst.x);
+                        break;
+                    case regex_opcode::split:
+                        stack.push_back(inst.y);
+                        stack.push_back(inst.x);
+                        break;
+                    case regex_opcode::assert_begin:
+                        if (pos == 0)
+                        {
+                            stack.push_back(pc + 1);
+                        }
+                        break;
+                    case regex_opcode::assert_end:
+                        if (pos == length)
+                        {
+                            stack.push_back(pc + 1);
+                        }
+                        break;
+                    case regex_opcode::word_boundary:
+                    case regex_opcode::not_word_boundary:
+                    {
+                        bool before = pos > 0 && is_word_unit(data[pos-1]);
+                        bool after = pos < length && is_word_unit(data[pos]);
+                        if ((before != after) == (inst.opcode == regex_opcode::word_boundary))
+                        {
+                            stack.push_back(pc + 1);
+                        }
+                        break;
+                    }
+                    default:
+                        list.push_back(vm_thread{pc, start});
+                        break;
+                }
+            }
+        }
+
+        bool run(const char_type* data, std::size_t length, std::size_t start, bool any_match,
+            std::size_t& first, std::size_t& last) const
+        {
+            if (anchored_ && start > 0)
+            {
+                return false;
+            }
+            std::vector<vm_thread> current;
+            std::vector<vm_thread> next;
+            std::vector<std::size_t> marks(program_.size(), 0);
+            std::vector<std::size_t> stack;
+            current.reserve(program_.size());
+            next.reserve(program_.size());
+
+            bool matched = false;
+            std::size_t pos = start;
+            const char_type* end = data + length;
+            for (;;)
+            {
+                if (!matched && (!anchored_ || pos == 0))
+                {
+                    add_thread(current, marks, stack, 0, pos, data, length, pos);
+                }
+                std::size_t n = 1;
+                uint32_t c = pos < length ? code_units::next(data + pos, end, n) : 0;
+                for (const auto& t : current)
+                {
+                    const regex_instruction& inst = program_[t.pc];
+                    if (inst.opcode == regex_opcode::match)
+                    {
+                        matched = true;
+                        first = t.start;
+                        last = pos;
+                        if (any_match)
+                        {
+                            return true;
+                        }
+                        break; // the remaining threads have lower priority
+                    }
+                    if (pos < length && (inst.opcode == regex_opcode::character ? c == inst.value : classes_[inst.value].contains(c)))
+                    {
+                        add_thread(next, marks, stack, t.pc + 1, t.start, data, length, pos + n);
+                    }
+                }
+                if (pos >= length || (next.empty() && (matched || anchored_)))
+                {
+                    break;
+                }
+                current.swap(next);
+                next.clear();
+                pos += n;
+            }
+            return matched;
+        }
+    };
+
+    // Parses an ECMAScript pattern and compiles it for nfa_regex_engine
+    template <typename CharT>
+    class regex_compiler
+    {
+        using char_type = CharT;
+        using code_units = regex_code_units<CharT>;
+        using range_type = regex_char_class::range_type;
+
+        static constexpr std::size_t unbounded = (std::numeric_limits<std::size_t>::max)();
+        static constexpr std::size_t max_depth = 256;
+        static constexpr std::size_t max_count = 100000;
+
+        enum class node_kind : uint8_t
+        {
+            empty,
+            character,
+            char_class,
+            concat,
+            alternate,
+            repeat,
+            assert_begin,
+            assert_end,
+            word_boundary,
+            not_word_boundary
+        };
+
+        struct node
+        {
+            node_kind kind;
+            uint32_t value;
+            std::size_t min;
+            std::size_t max;
+            bool greedy;
+            std::vector<std::size_t> children;
+
+            node(node_kind kind, uint32_t value = 0)
+                : kind(kind), value(value), min(0), max(0), greedy(true)
+            {
+            }
+        };
+
+        const char_type* p_;
+        const char_type* end_;
+        bool icase_;
+        std::size_t depth_{0};
+        std::vector<node> nodes_;
+        std::vector<regex_char_class> classes_;
+        std::vector<regex_instruction> program_;
+    public:
+        regex_compiler(const char_type* data, std::size_t length, bool icase)
+            : p_(data), end_(data + length), icase_(icase)
+        {
+        }
+
+        std::shared_ptr<const basic_regex_engine<CharT>> compile(std::error_code& ec)
+        {
+            std::size_t root = parse_disjunction(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return nullptr;
+            }
+            if (p_ != end_)
+            {
+                ec = regex_errc::unmatched_parenthesis;
+                return nullptr;
+            }
+            emit(root, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return nullptr;
+            }
+            program_.emplace_back(regex_opcode::match);
+            return std::make_shared<nfa_regex_engine<CharT>>(std::move(program_), std::move(classes_));
+        }
+
+    private:
+        static const std::vector<range_type>& digit_ranges()
+        {
+            static const std::vector<range_type> ranges = {{'0','9'}};
+            return ranges;
+        }
+
+        static const std::vector<range_type>& word_ranges()
+        {
+            static const std::vector<range_type> ranges = {{'0','9'},{'A','Z'},{'_','_'},{'a','z'}};
+            return ranges;
+        }
+
+        static const std::vector<range_type>& space_ranges()
+        {
+            static const std::vector<range_type> ranges = {{0x09,0x0d},{0x20,0x20},{0xa0,0xa0},{0x1680,0x1680},
+                {0x2000,0x200a},{0x2028,0x2029},{0x202f,0x202f},{0x205f,0x205f},{0x3000,0x3000},{0xfeff,0xfeff}};
+            return ranges;
+        }
+
+        static bool is_digit(char_type c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        static int hex_value(char_type c)
+        {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
+        std::size_t add_node(node&& n)
+        {
+            nodes_.push_back(std::move(n));
+            return nodes_.size() - 1;
+        }
+
+        std::size_t add_class(regex_char_class&& cls)
+        {
+            cls.finish(icase_);
+            classes_.push_back(std::move(cls));
+            return add_node(node(node_kind::char_class, static_cast<uint32_t>(classes_.size() - 1)));
+        }
+
+        std::size_t add_literal(uint32_t cp)
+        {
+            if (icase_ && ((cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z')))
+            {
+                regex_char_class cls;
+                cls.add(cp, cp);
+                return add_class(std::move(cls));
+            }
+            return add_node(node(node_kind::character, cp));
+        }
+
+        // Adds the class for \d, \D, \w, \W, \s or \S, returns false for any other character
+        static bool add_class_escape(regex_char_class& cls, char_type c)
+        {
+            switch (c)
+            {
+                case 'd': cls.add(digit_ranges()); return true;
+                case 'D': cls.add_complement(digit_ranges()); return true;
+                case 'w': cls.add(word_ranges()); return true;
+                case 'W': cls.add_complement(word_ranges()); return true;
+                case 's': cls.add(space_ranges()); return true;
+                case 'S': cls.add_complement(space_ranges()); return true;
+                default: return false;
+            }
+        }
+
+        std::size_t parse_disjunction(std::error_code& ec)
+        {
+            if (++depth_ > max_depth)
+            {
+                ec = regex_errc::too_large;
+                return 0;
+            }
+            std::vector<std::size_t> alternatives;
+            alternatives.push_back(parse_alternative(ec));
+            while (!ec && p_ != end_ && *p_ == '|')
+            {
+                ++p_;
+                alternatives.push_back(parse_alternative(ec));
+            }
+            --depth_;
+            if (ec || alternatives.size() == 1)
+            {
+                return alternatives.front();
+            }
+            node n(node_kind::alternate);
+            n.children = std::move(alternatives);
+            return add_node(std::move(n));
+        }
+
+        std::size_t parse_alternative(std::error_code& ec)
+        {
+            std::vector<std::size_t> terms;
+            while (p_ != end_ && *p_ != '|' && *p_ != ')')
+            {
+                std::size_t atom = 0;
+                bool quantifiable = true;
+                switch (*p_)
+                {
+                    case '^':
+                        ++p_;
+                        atom = add_node(node(node_kind::assert_begin));
+                        quantifiable = false;
+                        break;
+                    case '$':
+                        ++p_;
+                        atom = add_node(node(node_kind::assert_end));
+                        quantifiable = false;
+                        break;
+                    case '(':
+                        atom = parse_group(ec);
+                        break;
+                    case '[':
+                        atom = parse_class(ec);
+                        break;
+                    case '.':
+                    {
+                        ++p_;
+                        regex_char_class cls;
+                        cls.add_complement({{0x0a,0x0a},{0x0d,0x0d},{0x2028,0x2029}});
+                        atom = add_class(std::move(cls));
+                        break;
+                    }
+                    case '\\':
+                        atom = parse_atom_escape(quantifiable, ec);
+                        break;
+                    case '*':
+                    case '+':
+                    case '?':
+                        ec = regex_errc::nothing_to_repeat;
+                        break;
+                    case '{':
+                    {
+                        std::size_t min, max;
+                        const char_type* p = p_;
+                        if (parse_braces(min, max, ec) || ec)
+                        {
+                            p_ = p;
+                            ec = regex_errc::nothing_to_repeat;
+                            break;
+                        }
+                        ++p_;
+                        atom = add_literal('{');
+                        break;
+                    }
+                    default:
+                    {
+                        std::size_t n;
+                        uint32_t cp = code_units::next(p_, end_, n);
+                        p_ += n;
+                        atom = add_literal(cp);
+                        break;
+                    }
+                }
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return 0;
+                }
+                atom = parse_quantifier(atom, quantifiable, ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return 0;
+                }
+                terms.push_back(atom);
+            }
+            if (terms.empty())
+            {
+                return add_node(node(node_kind::empty));
+            }
+            if (terms.size() == 1)
+            {
+                return terms.front();
+            }
+            node n(node_kind::concat);
+            n.children = std::move(terms);
+            return add_node(std::move(n));
+        }
+
+        std::size_t parse_quantifier(std::size_t atom, bool quantifiable, std::error_code& ec)
+        {
+            if (p_ == end_)
+            {
+                return atom;
+            }
+            std::size_t min = 0;
+            std::size_t max = 0;
+            switch (*p_)
+            {
+                case '*':
+                    min = 0;
+                    max = unbounded;
+                    ++p_;
+                    break;
+                case '+':
+                    min = 1;
+                    max = unbounded;
+                    ++p_;
+                    break;
+                case '?':
+                    min = 0;
+                    max = 1;
+                    ++p_;
+                    break;
+                case '{':
+                    if (!parse_braces(min, max, ec))
+                    {
+                        return atom; // a literal '{'
+                    }
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return 0;
+                    }
+                    break;
+                default:
+                    return atom;
+            }
+            if (!quantifiable)
+            {
+                ec = regex_errc::nothing_to_repeat;
+                return 0;
+            }
+            node n(node_kind::repeat);
+            n.min = min;
+            n.max = max;
+            if (p_ != end_ && *p_ == '?')
+            {
+                n.greedy = false;
+                ++p_;
+            }
+            n.children.push_back(atom);
+            return add_node(std::move(n));
+        }
+
+        // Parses {n}, {n,} or {n,m} at p_, returns false and leaves p_ unchanged if there is none
+        bool parse_braces(std::size_t& min, std::size_t& max, std::error_code& ec)
+        {
+            const char_type* p = p_ + 1;
+            if (!read_count(p, min))
+            {
+                return false;
+            }
+            if (p != end_ && *p == '}')
+            {
+                max = min;
+            }
+            else if (p != end_ && *p == ',')
+            {
+                ++p;
+                if (p != end_ && *p == '}')
+                {
+                    max = unbounded;
+                }
+                else if (!read_count(p, max) || p == end_ || *p != '}')
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return false;
+            }
+            p_ = p + 1;
+            if (min > max)
+            {
+                ec = regex_errc::invalid_quantifier;
+            }
+            return true;
+        }
+
+        bool read_count(const char_type*& p, std::size_t& value) const
+        {
+            if (p == end_ || !is_digit(*p))
+            {
+                return false;
+            }
+            value = 0;
+            while (p != end_ && is_digit(*p))
+            {
+                value = value*10 + static_cast<std::size_t>(*p - '0');
+                if (value > max_count)
+                {
+                    value = max_count;
+                }
+                ++p;
+            }
+            return true;
+        }
+
+        std::size_t parse_group(std::error_code& ec)
+        {
+            ++p_;
+            if (p_ != end_ && *p_ == '?')
+            {
+                ++p_;
+                if (p_ == end_)
+                {
+                    ec = regex_errc::unexpected_end;
+                    return 0;
+                }
+                switch (*p_)
+                {
+                    case ':':
+                        ++p_;
+                        break;
+                    case '=':
+                    case '!':
+                        ec = regex_errc::unsupported;
+                        return 0;
+                    case '<':
+                        ++p_;
+                        if (p_ != end_ && (*p_ == '=' || *p_ == '!'))
+                        {
+                            ec = regex_errc::unsupported;
+                            return 0;
+                        }
+                        if (p_ == end_ || *p_ == '>')
+                        {
+                            ec = regex_errc::invalid_group;
+                            return 0;
+                        }
+                        while (p_ != end_ && *p_ != '>')
+                        {
+                            ++p_;
+                        }
+                        if (p_ == end_)
+                        {
+                            ec = regex_errc::unexpected_end;
+                            return 0;
+                        }
+                        ++p_;
+                        break;
+                    default:
+                        ec = regex_errc::invalid_group;
+                        return 0;
+                }
+            }
+            std::size_t index = parse_disjunction(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return 0;
+            }
+            if (p_ == end_)
+            {
+                ec = regex_errc::unmatched_parenthesis;
+                return 0;
+            }
+            ++p_;
+            return index;
+        }
+
+        std::size_t parse_atom_escape(bool& quantifiable, std::error_code& ec)
+        {
+            ++p_;
+            if (p_ == end_)
+            {
+                ec = regex_errc::unexpected_end;
+                return 0;
+            }
+            regex_char_class cls;
+            if (add_class_escape(cls, *p_))
+            {
+                if (*p_ == 'D' || *p_ == 'W' || *p_ == 'S')
+                {
+                    // Keep the class small, the complement is taken on lookup
+                    cls.ranges.clear();
+                    add_class_escape(cls, static_cast<char_type>(*p_ + ('a' - 'A')));
+                    cls.negated = true;
+                }
+                ++p_;
+                return add_class(std::move(cls));
+            }
+            switch (*p_)
+            {
+                case 'b':
+                    ++p_;
+                    quantifiable = false;
+                    return add_node(node(node_kind::word_boundary));
+                case 'B':
+                    ++p_;
+                    quantifiable = false;
+                    return add_node(node(node_kind::not_word_boundary));
+                case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
+                case 'k':
+                case 'p':
+                case 'P':
+                    ec = regex_errc::unsupported;
+                    return 0;
+                default:
+                {
+                    uint32_t cp = parse_char_escape(ec);
+                    return ec ? 0 : add_literal(cp);
+                }
+            }
+        }
+
+        // Parses the escape following a backslash at p_
+        uint32_t parse_char_escape(std::error_code& ec)
+        {
+            char_type c = *p_++;
+            switch (c)
+            {
+                case 't': return 0x09;
+                case 'n': return 0x0a;
+                case 'v': return 0x0b;
+                case 'f': return 0x0c;
+                case 'r': return 0x0d;
+                case '0':
+                    if (p_ != end_ && is_digit(*p_))
+                    {
+                        ec = regex_errc::unsupported;
+                        return 0;
+                    }
+                    return 0;
+                case 'c':
+                    if (p_ != end_ && ((*p_ >= 'a' && *p_ <= 'z') || (*p_ >= 'A' && *p_ <= 'Z')))
+                    {
+                        return static_cast<uint32_t>(*p_++) % 32;
+                    }
+                    ec = regex_errc::invalid_escape;
+                    return 0;
+                case 'x':
+                    return read_hex(2, ec);
+                case 'u':
+                {
+                    if (p_ != end_ && *p_ == '{')
+                    {
+                        ++p_;
+                        uint32_t cp = 0;
+                        std::size_t count = 0;
+                        int v;
+                        while (p_ != end_ && (v = hex_value(*p_)) >= 0 && cp <= 0x10ffff)
+                        {
+                            cp = cp*16 + static_cast<uint32_t>(v);
+                            ++p_;
+                            ++count;
+                        }
+                        if (count == 0 || cp > 0x10ffff || p_ == end_ || *p_ != '}')
+                        {
+                            ec = regex_errc::invalid_escape;
+                            return 0;
+                        }
+                        ++p_;
+                        return cp;
+                    }
+                    uint32_t cp = read_hex(4, ec);
+                    if (!ec && cp >= 0xd800 && cp <= 0xdbff && end_ - p_ >= 6 && p_[0] == '\\' && p_[1] == 'u')
+                    {
+                        const char_type* p = p_;
+                        p_ += 2;
+                        std::error_code ec2;
+                        uint32_t low = read_hex(4, ec2);
+                        if (!ec2 && low >= 0xdc00 && low <= 0xdfff)
+                        {
+                            return 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                        }
+                        p_ = p;
+                    }
+                    return cp;
+                }
+                default:
+                    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || is_digit(c))
+                    {
+                        ec = regex_errc::invalid_escape;
+                        return 0;
+                    }
+                    if (static_cast<uint32_t>(c) < 0x80)
+                    {
+                        return static_cast<uint32_t>(c); // identity escape
+                    }
+                    std::size_t n;
+                    uint32_t cp = code_units::next(p_ - 1, end_, n);
+                    p_ += n - 1;
+                    return cp;
+            }
+        }
+
+        uint32_t read_hex(std::size_t count, std::error_code& ec)
+        {
+            uint32_t cp = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                int v = p_ != end_ ? hex_value(*p_) : -1;
+                if (v < 0)
+                {
+                    ec = regex_errc::invalid_escape;
+                    return 0;
+                }
+                cp = cp*16 + static_cast<uint32_t>(v);
+                ++p_;
+            }
+            return cp;
+        }
+
+        std::size_t parse_class(std::error_code& ec)
+        {
+            ++p_;
+            regex_char_class cls;
+            if (p_ != end_ && *p_ == '^')
+            {
+                cls.negated = true;
+                ++p_;
+            }
+            for (;;)
+            {
+                if (p_ == end_)
+                {
+                    ec = regex_errc::unmatched_bracket;
+                    return 0;
+                }
+                if (*p_ == ']')
+                {
+                    ++p_;
+                    break;
+                }
+                uint32_t lo = 0;
+                if (parse_class_atom(cls, lo, ec))
+                {
+                    continue; // a class escape, a following '-' is a literal
+                }
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return 0;
+                }
+                if (end_ - p_ >= 2 && *p_ == '-' && p_[1] != ']')
+                {
+                    ++p_;
+                    uint32_t hi = 0;
+                    if (parse_class_atom(cls, hi, ec))
+                    {
+                        cls.add(lo, lo);
+                        cls.add('-', '-');
+                        continue;
+                    }
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return 0;
+                    }
+                    if (lo > hi)
+                    {
+                        ec = regex_errc::invalid_range;
+                        return 0;
+                    }
+                    cls.add(lo, hi);
+                }
+                else
+                {
+                    cls.add(lo, lo);
+                }
+            }
+            return add_class(std::move(cls));
+        }
+
+        // Returns true if a class escape was added to cls, otherwise sets value to the character read
+        bool parse_class_atom(regex_char_class& cls, uint32_t& value, std::error_code& ec)
+        {
+            if (*p_ == '\\')
+            {
+                ++p_;
+                if (p_ == end_)
+                {
+                    ec = regex_errc::unexpected_end;
+                    return false;
+                }
+                if (add_class_escape(cls, *p_))
+                {
+                    ++p_;
+                    return true;
+                }
+                switch (*p_)
+                {
+                    case 'b':
+                        ++p_;
+                        value = 0x08;
+                        break;
+                    case '-':
+                        ++p_;
+                        value = '-';
+                        break;
+                    case 'p':
+                    case 'P':
+                        ec = regex_errc::unsupported;
+                        break;
+                    default:
+                        value = parse_char_escape(ec);
+                        break;
+                }
+                return false;
+            }
+            std::size_t n;
+            value = code_units::next(p_, end_, n);
+            p_ += n;
+            return false;
+        }
+
+        std::size_t push(regex_opcode opcode, uint32_t value = 0)
+        {
+            program_.emplace_back(opcode, value);
+            return program_.size() - 1;
+        }
+
+        void emit(std::size_t index, std::error_code& ec)
+        {
+            if (program_.size() > JSONCONS_REGEX_MAX_PROGRAM_SIZE)
+            {
+                ec = regex_errc::too_large;
+                return;
+            }
+            const node& n = nodes_[index];
+            switch (n.kind)
+            {
+                case node_kind::empty:
+                    break;
+                case node_kind::character:
+                    push(regex_opcode::character, n.value);
+                    break;
+                case node_kind::char_class:
+                    push(regex_opcode::char_class, n.value);
+                    break;
+                case node_kind::assert_begin:
+                    push(regex_opcode::assert_begin);
+                    break;
+                case node_kind::assert_end:
+                    push(regex_opcode::assert_end);
+                    break;
+                case node_kind::word_boundary:
+                    push(regex_opcode::word_boundary);
+                    break;
+                case node_kind::not_word_boundary:
+                    push(regex_opcode::not_word_boundary);
+                    break;
+                case node_kind::concat:
+                    for (auto child : n.children)
+                    {
+                        emit(child, ec);
+                    }
+                    break;
+                case node_kind::alternate:
+                {
+                    std::vector<std::size_t> jumps;
+                    for (std::size_t i = 0; i + 1 < n.children.size(); ++i)
+                    {
+                        std::size_t split = push(regex_opcode::split);
+                        program_[split].x = program_.size();
+                        emit(n.children[i], ec);
+                        jumps.push_back(push(regex_opcode::jump));
+                        program_[split].y = program_.size();
+                    }
+                    emit(n.children.back(), ec);
+                    for (auto pc : jumps)
+                    {
+                        program_[pc].x = program_.size();
+                    }
+                    break;
+                }
+                case node_kind::repeat:
+                    emit_repeat(n, ec);
+                    break;
+            }
+        }
+
+        void set_split(std::size_t pc, std::size_t body, std::size_t skip, bool greedy)
+        {
+            program_[pc].x = greedy ? body : skip;
+            program_[pc].y = greedy ? skip : body;
+        }
+
+        void emit_repeat(const node& n, std::error_code& ec)
+        {
+            const std::size_t child = n.children.front();
+            if (n.max == unbounded)
+            {
+                if (n.min == 0)
+                {
+                    // L1: split L2, L3; L2: child; jump L1; L3:
+                    std::size_t split = push(regex_opcode::split);
+                    emit(child, ec);
+                    std::size_t jump = push(regex_opcode::jump);
+                    program_[jump].x = split;
+                    set_split(split, split + 1, program_.size(), n.greedy);
+                }
+                else
+                {
+                    for (std::size_t i = 0; i + 1 < n.min && !ec; ++i)
+                    {
+                        emit(child, ec);
+                    }
+                    // L1: child; split L1, L2; L2:
+                    std::size_t body = program_.size();
+                    emit(child, ec);
+                    std::size_t split = push(regex_opcode::split);
+                    set_split(split, body, program_.size(), n.greedy);
+                }
+                return;
+            }
+            for (std::size_t i = 0; i < n.min && !ec; ++i)
+            {
+                emit(child, ec);
+            }
+            // Each optional copy may skip to the end: split L1, end; L1: child; ...
+            std::vector<std::size_t> splits;
+            for (std::size_t i = n.min; i < n.max && !ec; ++i)
+            {
+                splits.push_back(push(regex_opcode::split));
+                emit(child, ec);
+            }
+            for (auto split : splits)
+            {
+                set_split(split, split + 1, program_.size(), n.greedy);
+            }
+        }
+    };
+
+#if defined(JSONCONS_HAS_STD_REGEX)
+
+    template <typename CharT>
+    class std_regex_engine : public basic_regex_engine<CharT>
+    {
+        using char_type = CharT;
+
+        std::basic_regex<char_type> regex_;
+    public:
+        std_regex_engine(std::basic_regex<char_type>&& regex)
+            : regex_(std::move(regex))
+        {
+        }
+
+        bool search(const char_type* data, std::size_t length, std::size_t start,
+            std::size_t& first, std::size_t& last) const override
+        {
+            std::match_results<const char_type*> m;
+            auto flags = start > 0 ? std::regex_constants::match_prev_avail : std::regex_constants::match_default;
+            if (!std::regex_search(data + start, data + length, m, regex_, flags))
+            {
+                return false;
+            }
+            first = start + static_cast<std::size_t>(m.position(0));
+            last = first + static_cast<std::size_t>(m.length(0));
+            return true;
+        }
+
+        bool contains(const char_type* data, std::size_t length) const override
+        {
+            return std::regex_search(data, data + length, regex_);
+        }
+
+        static std::shared_ptr<const basic_regex_engine<CharT>> make(const char_type* data, std::size_t length,
+            regex_options options, std::error_code& ec)
+        {
+            auto flags = std::regex_constants::ECMAScript;
+            if (options == regex_options::icase)
+            {
+                flags |= std::regex_constants::icase;
+            }
+            JSONCONS_TRY
+            {
+                return std::make_shared<std_regex_engine<CharT>>(std::basic_regex<char_type>(data, length, flags));
+            }
+            JSONCONS_CATCH(const std::regex_error&)
+            {
+                ec = regex_errc::invalid_pattern;
+                return nullptr;
+            }
+        }
+    };
+
+#endif // defined(JSONCONS_HAS_STD_REGEX)
+
+} // namespace detail
+
+    // A compiled ECMAScript regular expression.
+    //
+    // Patterns are matched by a built-in engine that takes time linear in the length of the input.
+    // Patterns with lookaround assertions, backreferences or unicode property escapes are matched
+    // with std::regex when it is available, or with std::regex for all patterns if
+    // JSONCONS_USE_STD_REGEX is defined. Case insensitive matching folds ASCII letters only.
+    template <typename CharT>
+    class basic_regex_pattern
+    {
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+        using engine_type = basic_regex_engine<CharT>;
+    private:
+        std::shared_ptr<const engine_type> engine_;
+    public:
+        basic_regex_pattern() = default;
+
+        explicit basic_regex_pattern(std::shared_ptr<const engine_type> engine)
+            : engine_(std::move(engine))
+        {
+        }
+
+        static basic_regex_pattern compile(const string_view_type& pattern,
+            regex_options options, std::error_code& ec)
+        {
+#if defined(JSONCONS_USE_STD_REGEX) && defined(JSONCONS_HAS_STD_REGEX)
+            return basic_regex_pattern(detail::std_regex_engine<CharT>::make(pattern.data(), pattern.size(), options, ec));
+#else
+            detail::regex_compiler<CharT> compiler(pattern.data(), pattern.size(), options == regex_options::icase);
+            auto engine = compiler.compile(ec);
+#if defined(JSONCONS_HAS_STD_REGEX)
+            if (ec == regex_errc::unsupported)
+            {
+                ec.clear();
+                engine = detail::std_regex_engine<CharT>::make(pattern.data(), pattern.size(), options, ec);
+            }
+#endif
+            return basic_regex_pattern(std::move(engine));
+#endif
+        }
+
+        static basic_regex_pattern compile(const string_view_type& pattern,
+            regex_options options = regex_options::none)
+        {
+            std::error_code ec;
+            auto result = compile(pattern, options, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                JSONCONS_THROW(std::system_error(ec));
+            }
+            return result;
+        }
+
+        // Returns true if s contains a match
+        bool search(const string_view_type& s) const
+        {
+            return engine_ && engine_->contains(s.data(), s.size());
+        }
+
+        // Finds the leftmost match that starts at or after offset start of s, and sets [first, last) to its offsets
+        bool search(const string_view_type& s, std::size_t start, std::size_t& first, std::size_t& last) const
+        {
+            return engine_ && engine_->search(s.data(), s.size(), start, first, last);
+        }
+
+        const std::shared_ptr<const engine_type>& engine() const
+        {
+            return engine_;
+        }
+    };
+
+    using regex_pattern = basic_regex_pattern<char>;
+    using wregex_pattern = basic_regex_pattern<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_UTILITY_REGEX_HPP
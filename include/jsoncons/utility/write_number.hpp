@@ -20,7 +20,8 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
-#include <jsoncons/detail/grisu3.hpp>
+#include <jsoncons/detail/to_decimal.hpp>
+#include <jsoncons/detail/write_digits.hpp>
 #include <jsoncons/utility/read_number.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_options.hpp>
@@ -35,10 +36,47 @@ namespace utility {
         return (char)((c < 10) ? ('0' + c) : ('A' - 10 + c));
     }
 
+    // append_chars
+
+    template <typename Result>
+    typename std::enable_if<ext_traits::has_append<Result>::value && std::is_same<typename Result::value_type,char>::value>::type
+    append_chars(const char* s, std::size_t length, Result& result)
+    {
+        result.append(s, length);
+    }
+
+    template <typename Result>
+    typename std::enable_if<!(ext_traits::has_append<Result>::value && std::is_same<typename Result::value_type,char>::value)>::type
+    append_chars(const char* s, std::size_t length, Result& result)
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            result.push_back(s[i]);
+        }
+    }
+
     // from_integer
 
     template <typename Integer,typename Result>
-    typename std::enable_if<ext_traits::is_integer<Integer>::value,std::size_t>::type
+    typename std::enable_if<ext_traits::is_integer<Integer>::value && sizeof(Integer) <= sizeof(uint64_t),std::size_t>::type
+    from_integer(Integer value, Result& result)
+    {
+        char buf[21];
+        std::size_t count = 0;
+
+        uint64_t u = static_cast<uint64_t>(value);
+        if (value < 0)
+        {
+            buf[count++] = '-';
+            u = 0 - u;
+        }
+        count += jsoncons::detail::write_digits(u, buf + count);
+        append_chars(buf, count, result);
+        return count;
+    }
+
+    template <typename Integer,typename Result>
+    typename std::enable_if<ext_traits::is_integer<Integer>::value && (sizeof(Integer) > sizeof(uint64_t)),std::size_t>::type
     from_integer(Integer value, Result& result)
     {
         using char_type = typename Result::value_type;
@@ -289,7 +327,7 @@ namespace utility {
     }
 
     template <typename Result>
-    bool dtoa_scientific(double val, char decimal_point, Result& result)
+    bool dtoa_scientific(double val, char decimal_point, Result& result, std::false_type)
     {
         if (val == 0)
         {
@@ -325,6 +363,39 @@ namespace utility {
         return true;
     }
 
+    template <typename Result>
+    bool dtoa_scientific(double v, char, Result& result, std::true_type)
+    {
+        if (v == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            result.push_back('0');
+            return true;
+        }
+
+        char buffer[20];
+        int k;
+
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        std::size_t length = jsoncons::detail::to_shortest_digits(std::signbit(v) ? -v : v, buffer, k);
+        result.push_back(buffer[0]);
+        if (length > 1)
+        {
+            result.push_back('.');
+            for (std::size_t i = 1; i < length; ++i)
+            {
+                result.push_back(buffer[i]);
+            }
+        }
+        result.push_back('e');
+        fill_exponent(k + static_cast<int>(length) - 1, result);
+        return true;
+    }
+
     template <typename Result>
     bool dtoa_general(double val, char decimal_point, Result& result, std::false_type)
     {
@@ -363,7 +434,7 @@ namespace utility {
     }
 
     template <typename Result>
-    bool dtoa_general(double v, char decimal_point, Result& result, std::true_type)
+    bool dtoa_general(double v, char, Result& result, std::true_type)
     {
         if (v == 0)
         {
@@ -373,27 +444,18 @@ namespace utility {
             return true;
         }
 
-        int length = 0;
+        char buffer[20];
         int k;
 
-        char buffer[100];
-
-        double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        if (std::signbit(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            // min exp: -4 is consistent with sprintf
-            // max exp: std::numeric_limits<double>::max_digits10
-            jsoncons::utility::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
-            return true;
-        }
-        else
-        {
-            return dtoa_general(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        std::size_t length = jsoncons::detail::to_shortest_digits(std::signbit(v) ? -v : v, buffer, k);
+        // min exp: -4 is consistent with sprintf
+        // max exp: std::numeric_limits<double>::max_digits10
+        jsoncons::utility::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
+        return true;
     }
 
     template <typename Result>
@@ -434,7 +496,7 @@ namespace utility {
     }
 
     template <typename Result>
-    bool dtoa_fixed(double v, char decimal_point, Result& result, std::true_type)
+    bool dtoa_fixed(double v, char, Result& result, std::true_type)
     {
         if (v == 0)
         {
@@ -444,37 +506,192 @@ namespace utility {
             return true;
         }
 
-        int length = 0;
+        char buffer[20];
         int k;
 
-        char buffer[100];
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        std::size_t length = jsoncons::detail::to_shortest_digits(std::signbit(v) ? -v : v, buffer, k);
+        jsoncons::utility::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
+        return true;
+    }
 
-        double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+    template <typename Result>
+    bool dtoa_fixed(double v, char decimal_point, Result& result)
+    {
+        return dtoa_fixed(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
+    template <typename Result>
+    bool dtoa_general(double v, char decimal_point, Result& result)
+    {
+        return dtoa_general(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
+    template <typename Result>
+    bool dtoa_scientific(double v, char decimal_point, Result& result)
+    {
+        return dtoa_scientific(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
+    // Fixed precision, rounded half to even on the exact binary value, as printf does
+
+    template <typename Result>
+    bool dtoa_fixed(double v, int precision, char decimal_point, Result& result, std::false_type)
+    {
+        char buffer[200];
+        int length = snprintf(buffer, sizeof(buffer), "%1.*f", precision, v);
+        if (length < 0)
         {
-            if (std::signbit(v))
+            return false;
+        }
+        dump_buffer(buffer, length, decimal_point, result);
+        return true;
+    }
+
+    template <typename Result>
+    bool dtoa_fixed(double v, int precision, char, Result& result, std::true_type)
+    {
+        char buffer[jsoncons::detail::max_rounded_decimal_digits];
+        int e = 0;
+        std::size_t length = 0;
+
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        if (v != 0)
+        {
+            length = jsoncons::detail::to_rounded_decimal(std::signbit(v) ? -v : v, -precision, false, buffer, e);
+        }
+        if (length == 0 || e < 0)
+        {
+            result.push_back('0');
+        }
+        else
+        {
+            for (int i = 0; i <= e; ++i)
             {
-                result.push_back('-');
+                result.push_back(i < static_cast<int>(length) ? buffer[i] : '0');
+            }
+        }
+        if (precision > 0)
+        {
+            result.push_back('.');
+            for (int j = 1; j <= precision; ++j)
+            {
+                int i = e + j;
+                result.push_back(i >= 0 && i < static_cast<int>(length) ? buffer[i] : '0');
             }
-            jsoncons::utility::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
-            return true;
         }
         else
         {
-            return dtoa_fixed(v, decimal_point, result, std::false_type());
+            result.push_back('.');
+            result.push_back('0');
         }
+        return true;
     }
 
     template <typename Result>
-    bool dtoa_fixed(double v, char decimal_point, Result& result)
+    bool dtoa_scientific(double v, int precision, char decimal_point, Result& result, std::false_type)
     {
-        return dtoa_fixed(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+        char buffer[200];
+        int length = snprintf(buffer, sizeof(buffer), "%1.*e", precision, v);
+        if (length < 0)
+        {
+            return false;
+        }
+        dump_buffer(buffer, length, decimal_point, result);
+        return true;
     }
 
     template <typename Result>
-    bool dtoa_general(double v, char decimal_point, Result& result)
+    bool dtoa_scientific(double v, int precision, char, Result& result, std::true_type)
     {
-        return dtoa_general(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+        char buffer[jsoncons::detail::max_rounded_decimal_digits];
+        int e = 0;
+        std::size_t length = 0;
+
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        if (v != 0)
+        {
+            length = jsoncons::detail::to_rounded_decimal(std::signbit(v) ? -v : v, precision + 1, true, buffer, e);
+        }
+        result.push_back(length > 0 ? buffer[0] : '0');
+        if (precision > 0)
+        {
+            result.push_back('.');
+            for (int i = 1; i <= precision; ++i)
+            {
+                result.push_back(i < static_cast<int>(length) ? buffer[i] : '0');
+            }
+        }
+        result.push_back('e');
+        fill_exponent(e, result);
+        return true;
+    }
+
+    template <typename Result>
+    bool dtoa_general(double v, int precision, char decimal_point, Result& result, std::false_type)
+    {
+        char buffer[200];
+        int length = snprintf(buffer, sizeof(buffer), "%1.*g", precision, v);
+        if (length < 0)
+        {
+            return false;
+        }
+        dump_buffer(buffer, length, decimal_point, result);
+        return true;
+    }
+
+    template <typename Result>
+    bool dtoa_general(double v, int precision, char, Result& result, std::true_type)
+    {
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        if (v == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            result.push_back('0');
+            return true;
+        }
+
+        char buffer[jsoncons::detail::max_rounded_decimal_digits];
+        int e = 0;
+        if (precision == 0)
+        {
+            precision = 1;
+        }
+        std::size_t length = jsoncons::detail::to_rounded_decimal(std::signbit(v) ? -v : v, precision, true, buffer, e);
+        // %g style: fixed notation for exponents in [-4, precision)
+        jsoncons::utility::prettify_string(buffer, length, e - static_cast<int>(length) + 1, -4, precision, result);
+        return true;
+    }
+
+    template <typename Result>
+    bool dtoa_fixed(double v, int precision, char decimal_point, Result& result)
+    {
+        return dtoa_fixed(v, precision, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
+    template <typename Result>
+    bool dtoa_scientific(double v, int precision, char decimal_point, Result& result)
+    {
+        return dtoa_scientific(v, precision, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
+    template <typename Result>
+    bool dtoa_general(double v, int precision, char decimal_point, Result& result)
+    {
+        return dtoa_general(v, precision, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
     }
 
     class write_double
@@ -504,21 +721,16 @@ namespace utility {
         {
             std::size_t count = 0;
 
-            char number_buffer[200];
-            int length = 0;
-
             switch (float_format_)
             {
             case float_chars_format::fixed:
                 {
                     if (precision_ > 0)
                     {
-                        length = snprintf(number_buffer, sizeof(number_buffer), "%1.*f", precision_, val);
-                        if (length < 0)
+                        if (!dtoa_fixed(val, precision_, decimal_point_, result))
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
                     }
                     else
                     {
@@ -533,12 +745,10 @@ namespace utility {
                 {
                     if (precision_ > 0)
                     {
-                        length = snprintf(number_buffer, sizeof(number_buffer), "%1.*e", precision_, val);
-                        if (length < 0)
+                        if (!dtoa_scientific(val, precision_, decimal_point_, result))
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
                     }
                     else
                     {
@@ -553,12 +763,10 @@ namespace utility {
                 {
                     if (precision_ > 0)
                     {
-                        length = snprintf(number_buffer, sizeof(number_buffer), "%1.*g", precision_, val);
-                        if (length < 0)
+                        if (!dtoa_general(val, precision_, decimal_point_, result))
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
                     }
                     else
                     {
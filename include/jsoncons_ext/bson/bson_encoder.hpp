@@ -51,11 +51,12 @@ public:
     using sink_type = Sink;
 
 private:
+    using seekable_sink_type = std::integral_constant<bool,ext_traits::is_seekable_sink<Sink>::value>;
+
     struct stack_item
     {
         jsoncons::bson::bson_container_type type_;
         std::size_t offset_{0};
-        std::size_t name_offset_{0};
         std::size_t index_{0};
 
         stack_item(jsoncons::bson::bson_container_type type, std::size_t offset) noexcept
@@ -68,16 +69,6 @@ private:
             return offset_;
         }
 
-        std::size_t member_offset() const
-        {
-            return name_offset_;
-        }
-
-        void member_offset(std::size_t offset) 
-        {
-            name_offset_ = offset;
-        }
-
         std::size_t next_index()
         {
             return index_++;
@@ -97,7 +88,10 @@ private:
 
     std::vector<stack_item> stack_;
     std::vector<uint8_t> buffer_;
+    std::string key_;
     int nesting_depth_{0};
+    bool write_through_{false};
+    bool done_{false};
 public:
 
     // Noncopyable and nonmoveable
@@ -133,7 +127,10 @@ public:
     {
         stack_.clear();
         buffer_.clear();
+        key_.clear();
         nesting_depth_ = 0;
+        write_through_ = false;
+        done_ = false;
     }
 
     void reset(Sink&& sink)
@@ -157,18 +154,13 @@ private:
             ec = bson_errc::max_nesting_depth_exceeded;
             JSONCONS_VISITOR_RETURN;
         } 
-        if (buffer_.size() > 0)
+        if (!begin_container(jsoncons::bson::bson_type::document_type, ec))
         {
-            if (stack_.empty())
-            {
-                ec = bson_errc::expected_bson_document;
-                JSONCONS_VISITOR_RETURN;
-            }
-            before_value(jsoncons::bson::bson_type::document_type);
+            JSONCONS_VISITOR_RETURN;
         }
 
-        stack_.emplace_back(jsoncons::bson::bson_container_type::document, buffer_.size());
-        buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
+        stack_.emplace_back(jsoncons::bson::bson_container_type::document, position());
+        write_little(int32_t(0)); // reserve space for length
 
         JSONCONS_VISITOR_RETURN;
     }
@@ -178,19 +170,7 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         --nesting_depth_;
 
-        buffer_.push_back(0x00);
-
-        std::size_t length = buffer_.size() - stack_.back().offset();
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+stack_.back().offset());
-
-        stack_.pop_back();
-        if (stack_.empty())
-        {
-            for (auto c : buffer_)
-            {
-                sink_.push_back(c);
-            }
-        }
+        end_container();
         JSONCONS_VISITOR_RETURN;
     }
 
@@ -201,17 +181,12 @@ private:
             ec = bson_errc::max_nesting_depth_exceeded;
             JSONCONS_VISITOR_RETURN;
         } 
-        if (buffer_.size() > 0)
+        if (!begin_container(jsoncons::bson::bson_type::array_type, ec))
         {
-            if (stack_.empty())
-            {
-                ec = bson_errc::expected_bson_document;
-                JSONCONS_VISITOR_RETURN;
-            }
-            before_value(jsoncons::bson::bson_type::array_type);
+            JSONCONS_VISITOR_RETURN;
         }
-        stack_.emplace_back(jsoncons::bson::bson_container_type::array, buffer_.size());
-        buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
+        stack_.emplace_back(jsoncons::bson::bson_container_type::array, position());
+        write_little(int32_t(0)); // reserve space for length
         JSONCONS_VISITOR_RETURN;
     }
 
@@ -220,31 +195,14 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         --nesting_depth_;
 
-        buffer_.push_back(0x00);
-
-        std::size_t length = buffer_.size() - stack_.back().offset();
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+stack_.back().offset());
-
-        stack_.pop_back();
-        if (stack_.empty())
-        {
-            for (auto c : buffer_)
-            {
-                sink_.push_back(c);
-            }
-        }
+        end_container();
         JSONCONS_VISITOR_RETURN;
     }
 
     JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
-        stack_.back().member_offset(buffer_.size());
-        buffer_.push_back(0x00); // reserve space for code
-        for (auto c : name)
-        {
-            buffer_.push_back(c);
-        }
-        buffer_.push_back(0x00);
+        // The type code precedes the name, so the name is written with the value
+        key_.assign(name.data(), name.size());
         JSONCONS_VISITOR_RETURN;
     }
 
@@ -277,11 +235,11 @@ private:
         before_value(jsoncons::bson::bson_type::bool_type);
         if (val)
         {
-            buffer_.push_back(0x01);
+            write_byte(0x01);
         }
         else
         {
-            buffer_.push_back(0x00);
+            write_byte(0x00);
         }
 
         JSONCONS_VISITOR_RETURN;
@@ -307,8 +265,8 @@ private:
                     ec = bson_errc::invalid_decimal128_string;
                     JSONCONS_VISITOR_RETURN;
                 }
-                binary::native_to_little(dec.low,std::back_inserter(buffer_));
-                binary::native_to_little(dec.high,std::back_inserter(buffer_));
+                write_little(dec.low);
+                write_little(dec.high);
                 break;
             }
             case semantic_tag::id:
@@ -317,7 +275,7 @@ private:
                 oid_t oid(sv);
                 for (auto b : oid)
                 {
-                    buffer_.push_back(b);
+                    write_byte(b);
                 }
                 break;
             }
@@ -332,20 +290,19 @@ private:
                     JSONCONS_VISITOR_RETURN;
                 }
                 string_view regex = sv.substr(first+1,last-1);
-                for (auto c : regex)
-                {
-                    buffer_.push_back(c);
-                }
-                buffer_.push_back(0x00);
+                write_cstring(regex);
                 string_view options = sv.substr(last+1);
-                for (auto c : options)
-                {
-                    buffer_.push_back(c);
-                }
-                buffer_.push_back(0x00);
+                write_cstring(options);
                 break;
             }
             default:
+            {
+                auto sink = unicode_traits::validate(sv.data(), sv.size());
+                if (sink.ec != unicode_traits::conv_errc())
+                {
+                    ec = bson_errc::invalid_utf8_text_string;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 switch (tag)
                 {
                     case semantic_tag::code:
@@ -355,23 +312,10 @@ private:
                         before_value(jsoncons::bson::bson_type::string_type);
                         break;
                 }
-                std::size_t offset = buffer_.size();
-                buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
-                std::size_t string_offset = buffer_.size();
-                auto sink = unicode_traits::validate(sv.data(), sv.size());
-                if (sink.ec != unicode_traits::conv_errc())
-                {
-                    ec = bson_errc::invalid_utf8_text_string;
-                    JSONCONS_VISITOR_RETURN;
-                }
-                for (auto c : sv)
-                {
-                    buffer_.push_back(c);
-                }
-                buffer_.push_back(0x00);
-                std::size_t length = buffer_.size() - string_offset;
-                binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+offset);
+                write_little(static_cast<uint32_t>(sv.size()+1));
+                write_cstring(sv);
                 break;
+            }
         }
 
         JSONCONS_VISITOR_RETURN;
@@ -389,18 +333,9 @@ private:
         }
         before_value(jsoncons::bson::bson_type::binary_type);
 
-        std::size_t offset = buffer_.size();
-        buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
-        std::size_t string_offset = buffer_.size();
-
-        buffer_.push_back(0x80); // default subtype
-
-        for (auto c : b)
-        {
-            buffer_.push_back(c);
-        }
-        std::size_t length = buffer_.size() - string_offset - 1;
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+offset);
+        write_little(static_cast<uint32_t>(b.size()));
+        write_byte(0x80); // default subtype
+        write_bytes(b.data(), b.size());
 
         JSONCONS_VISITOR_RETURN;
     }
@@ -417,18 +352,9 @@ private:
         }
         before_value(jsoncons::bson::bson_type::binary_type);
 
-        std::size_t offset = buffer_.size();
-        buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
-        std::size_t string_offset = buffer_.size();
-
-        buffer_.push_back(static_cast<uint8_t>(ext_tag)); // default subtype
-
-        for (auto c : b)
-        {
-            buffer_.push_back(c);
-        }
-        std::size_t length = buffer_.size() - string_offset - 1;
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+offset);
+        write_little(static_cast<uint32_t>(b.size()));
+        write_byte(static_cast<uint8_t>(ext_tag)); // default subtype
+        write_bytes(b.data(), b.size());
 
         JSONCONS_VISITOR_RETURN;
     }
@@ -460,11 +386,11 @@ private:
                     JSONCONS_VISITOR_RETURN;
                 }
                 before_value(jsoncons::bson::bson_type::datetime_type);
-                binary::native_to_little(val*millis_in_second,std::back_inserter(buffer_));
+                write_little(val*millis_in_second);
                 break;
             case semantic_tag::epoch_milli:
                 before_value(jsoncons::bson::bson_type::datetime_type);
-                binary::native_to_little(val,std::back_inserter(buffer_));
+                write_little(val);
                 break;
             case semantic_tag::epoch_nano:
                 before_value(jsoncons::bson::bson_type::datetime_type);
@@ -472,19 +398,19 @@ private:
                 {
                     val /= nanos_in_milli;
                 }
-                binary::native_to_little(static_cast<int64_t>(val),std::back_inserter(buffer_));
+                write_little(static_cast<int64_t>(val));
                 break;
             default:
             {
                 if (val >= (std::numeric_limits<int32_t>::lowest)() && val <= (std::numeric_limits<int32_t>::max)())
                 {
                     before_value(jsoncons::bson::bson_type::int32_type);
-                    binary::native_to_little(static_cast<uint32_t>(val),std::back_inserter(buffer_));
+                    write_little(static_cast<uint32_t>(val));
                 }
                 else 
                 {
                     before_value(jsoncons::bson::bson_type::int64_type);
-                    binary::native_to_little(static_cast<int64_t>(val),std::back_inserter(buffer_));
+                    write_little(static_cast<int64_t>(val));
                 }
                 break;
             }
@@ -513,11 +439,11 @@ private:
                     JSONCONS_VISITOR_RETURN;
                 }
                 before_value(jsoncons::bson::bson_type::datetime_type);
-                binary::native_to_little(static_cast<int64_t>(val*millis_in_second),std::back_inserter(buffer_));
+                write_little(static_cast<int64_t>(val*millis_in_second));
                 break;
             case semantic_tag::epoch_milli:
                 before_value(jsoncons::bson::bson_type::datetime_type);
-                binary::native_to_little(static_cast<int64_t>(val),std::back_inserter(buffer_));
+                write_little(static_cast<int64_t>(val));
                 break;
             case semantic_tag::epoch_nano:
                 before_value(jsoncons::bson::bson_type::datetime_type);
@@ -525,19 +451,19 @@ private:
                 {
                     val /= nanos_in_second;
                 }
-                binary::native_to_little(static_cast<int64_t>(val),std::back_inserter(buffer_));
+                write_little(static_cast<int64_t>(val));
                 break;
             default:
             {
                 if (val <= static_cast<uint64_t>((std::numeric_limits<int32_t>::max)()))
                 {
                     before_value(jsoncons::bson::bson_type::int32_type);
-                    binary::native_to_little(static_cast<uint32_t>(val),std::back_inserter(buffer_));
+                    write_little(static_cast<uint32_t>(val));
                 }
                 else if (val <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
                 {
                     before_value(jsoncons::bson::bson_type::int64_type);
-                    binary::native_to_little(static_cast<uint64_t>(val),std::back_inserter(buffer_));
+                    write_little(static_cast<uint64_t>(val));
                 }
                 else
                 {
@@ -561,25 +487,157 @@ private:
             JSONCONS_VISITOR_RETURN;
         }
         before_value(jsoncons::bson::bson_type::double_type);
-        binary::native_to_little(val,std::back_inserter(buffer_));
+        write_little(val);
         JSONCONS_VISITOR_RETURN;
     }
 
     void before_value(uint8_t code) 
     {
         JSONCONS_ASSERT(!stack_.empty());
+        write_byte(code);
         if (stack_.back().is_object())
         {
-            buffer_[stack_.back().member_offset()] = code;
+            write_cstring(key_);
         }
         else
         {
-            buffer_.push_back(code);
             std::string name = std::to_string(stack_.back().next_index());
-            buffer_.insert(buffer_.end(), name.begin(), name.end());
-            buffer_.push_back(0x00);
+            write_cstring(name);
         }
     }
+
+    bool begin_container(uint8_t code, std::error_code& ec)
+    {
+        if (!stack_.empty())
+        {
+            before_value(code);
+        }
+        else if (done_)
+        {
+            ec = bson_errc::expected_bson_document;
+            return false;
+        }
+        else
+        {
+            write_through_ = options_.write_through() && is_seekable(seekable_sink_type());
+        }
+        return true;
+    }
+
+    void end_container()
+    {
+        write_byte(0x00);
+
+        std::size_t offset = stack_.back().offset();
+        write_length_at(offset, static_cast<uint32_t>(position() - offset));
+
+        stack_.pop_back();
+        if (stack_.empty())
+        {
+            done_ = true;
+            if (!write_through_)
+            {
+                for (auto c : buffer_)
+                {
+                    sink_.push_back(c);
+                }
+            }
+        }
+    }
+
+    // In write through mode bytes go straight to the sink and the length of each
+    // container is patched in place when the container ends, otherwise the whole
+    // document is buffered and copied to the sink at the end
+
+    bool is_seekable(std::true_type) const
+    {
+        return sink_.is_seekable();
+    }
+
+    bool is_seekable(std::false_type) const
+    {
+        return false;
+    }
+
+    std::size_t position() const
+    {
+        return position(seekable_sink_type());
+    }
+
+    std::size_t position(std::true_type) const
+    {
+        return write_through_ ? sink_.position() : buffer_.size();
+    }
+
+    std::size_t position(std::false_type) const
+    {
+        return buffer_.size();
+    }
+
+    void write_length_at(std::size_t offset, uint32_t length)
+    {
+        write_length_at(offset, length, seekable_sink_type());
+    }
+
+    void write_length_at(std::size_t offset, uint32_t length, std::true_type)
+    {
+        if (write_through_)
+        {
+            uint8_t buf[sizeof(uint32_t)];
+            binary::native_to_little(length, buf);
+            sink_.write_at(offset, buf, sizeof(uint32_t));
+        }
+        else
+        {
+            binary::native_to_little(length, buffer_.begin()+offset);
+        }
+    }
+
+    void write_length_at(std::size_t offset, uint32_t length, std::false_type)
+    {
+        binary::native_to_little(length, buffer_.begin()+offset);
+    }
+
+    void write_byte(uint8_t b)
+    {
+        if (write_through_)
+        {
+            sink_.push_back(b);
+        }
+        else
+        {
+            buffer_.push_back(b);
+        }
+    }
+
+    void write_bytes(const uint8_t* data, std::size_t length)
+    {
+        if (write_through_)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                sink_.push_back(data[i]);
+            }
+        }
+        else
+        {
+            buffer_.insert(buffer_.end(), data, data+length);
+        }
+    }
+
+    template <typename T>
+    void write_little(T val)
+    {
+        uint8_t buf[sizeof(T)];
+        binary::native_to_little(val, buf);
+        write_bytes(buf, sizeof(T));
+    }
+
+    void write_cstring(const string_view_type& sv)
+    {
+        write_bytes(reinterpret_cast<const uint8_t*>(sv.data()), sv.size());
+        write_byte(0x00);
+    }
 };
 
 using bson_stream_encoder = basic_bson_encoder<jsoncons::binary_stream_sink>;
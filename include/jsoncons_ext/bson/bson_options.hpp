@@ -50,9 +50,17 @@ public:
 class bson_encode_options : public virtual bson_options_common
 {
     friend class bson_options;
+
+    bool write_through_;
 public:
     bson_encode_options()
+        : write_through_(false)
+    {
+    }
+
+    bool write_through() const 
     {
+        return write_through_;
     }
 };
 
@@ -60,12 +68,19 @@ class bson_options final : public bson_decode_options, public bson_encode_option
 {
 public:
     using bson_options_common::max_nesting_depth;
+    using bson_encode_options::write_through;
 
     bson_options& max_nesting_depth(int value)
     {
         this->max_nesting_depth_ = value;
         return *this;
     }
+
+    bson_options& write_through(bool value)
+    {
+        this->write_through_ = value;
+        return *this;
+    }
 };
 
 } // namespace bson
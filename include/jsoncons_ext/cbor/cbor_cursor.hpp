@@ -12,12 +12,14 @@
 #include <ios>
 #include <memory> // std::allocator
 #include <system_error>
+#include <vector>
 
 #include <jsoncons/utility/byte_string.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/ser_util.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <jsoncons/source.hpp>
 #include <jsoncons/staj_cursor.hpp>
 #include <jsoncons_ext/cbor/cbor_parser.hpp>
@@ -173,6 +175,16 @@ public:
         return cursor_visitor_.event();
     }
 
+    // If the current event begins a typed array (RFC 8746) whose elements are T, copies the 
+    // elements into v with one bulk copy, reusing its capacity, and returns true. Like read_to, 
+    // the array is consumed, and next() moves to the event after it. Otherwise returns false 
+    // and leaves the cursor where it is.
+    template <typename T,typename Alloc>
+    bool read_typed_array(std::vector<T,Alloc>& v, std::error_code& ec)
+    {
+        return cursor_visitor_.read_typed_array(v, *this, ec);
+    }
+
     void read_to(basic_json_visitor<char_type>& visitor) override
     {
         std::error_code ec;
@@ -313,6 +325,7 @@ private:
 
 using cbor_stream_cursor = basic_cbor_cursor<jsoncons::binary_stream_source>;
 using cbor_bytes_cursor = basic_cbor_cursor<jsoncons::bytes_source>;
+using cbor_file_cursor = basic_cbor_cursor<jsoncons::binary_mmap_source>;
 
 } // namespace cbor
 } // namespace jsoncons
@@ -9,6 +9,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring> // std::memcmp
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_visitor.hpp>
@@ -80,6 +84,107 @@ size_t min_length_for_stringref(uint64_t index)
     return n;
 }
 
+// Strings and byte strings seen by a packed string encoder, mapped to their stringref index.
+// The bytes are copied into one arena and looked up through an open addressing table.
+template <typename Allocator>
+class stringref_table
+{
+    struct entry
+    {
+        std::size_t offset;
+        std::size_t length;
+        uint64_t hash;
+        std::size_t index;
+        bool is_byte_string;
+    };
+
+    using byte_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<uint8_t>;
+    using entry_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<entry>;
+    using slot_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<std::size_t>;
+
+    static constexpr std::size_t initial_slot_count = 64;
+
+    std::vector<uint8_t,byte_allocator_type> arena_;
+    std::vector<entry,entry_allocator_type> entries_;
+    std::vector<std::size_t,slot_allocator_type> slots_; // entry position + 1, 0 if empty
+public:
+    explicit stringref_table(const Allocator& alloc = Allocator())
+        : arena_(alloc), entries_(alloc), slots_(alloc)
+    {
+    }
+
+    std::size_t size() const
+    {
+        return entries_.size();
+    }
+
+    void clear()
+    {
+        arena_.clear();
+        entries_.clear();
+        slots_.clear();
+    }
+
+    // If the string is in the table, returns its index and false, otherwise
+    // adds it with the given index and returns that index and true
+    std::pair<std::size_t,bool> insert(const uint8_t* data, std::size_t length, bool is_byte_string, std::size_t index)
+    {
+        if (slots_.empty())
+        {
+            slots_.resize(initial_slot_count, 0);
+        }
+        uint64_t hash = hash_bytes(data, length, is_byte_string);
+        std::size_t mask = slots_.size() - 1;
+        std::size_t slot = static_cast<std::size_t>(hash) & mask;
+        for (; slots_[slot] != 0; slot = (slot + 1) & mask)
+        {
+            const entry& e = entries_[slots_[slot] - 1];
+            if (e.hash == hash && e.length == length && e.is_byte_string == is_byte_string &&
+                (length == 0 || std::memcmp(arena_.data() + e.offset, data, length) == 0))
+            {
+                return std::make_pair(e.index, false);
+            }
+        }
+
+        entries_.push_back(entry{arena_.size(), length, hash, index, is_byte_string});
+        arena_.insert(arena_.end(), data, data + length);
+        slots_[slot] = entries_.size();
+        if (entries_.size() * 2 > slots_.size())
+        {
+            rehash(slots_.size() * 2);
+        }
+        return std::make_pair(index, true);
+    }
+
+private:
+    static uint64_t hash_bytes(const uint8_t* data, std::size_t length, bool is_byte_string)
+    {
+        // FNV-1a
+        uint64_t hash = is_byte_string ? 14695981039346656037ull ^ 0xff : 14695981039346656037ull;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            hash ^= data[i];
+            hash *= 1099511628211ull;
+        }
+        return hash ^ (hash >> 32);
+    }
+
+    void rehash(std::size_t slot_count)
+    {
+        slots_.assign(slot_count, 0);
+        std::size_t mask = slot_count - 1;
+        for (std::size_t i = 0; i < entries_.size(); ++i)
+        {
+            std::size_t slot = static_cast<std::size_t>(entries_[i].hash) & mask;
+            while (slots_[slot] != 0)
+            {
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = i + 1;
+        }
+    }
+};
+
 } // namespace detail 
 } // namespace cbor
 } // namespace jsoncons
@@ -11,7 +11,6 @@
 #include <cstdint>
 #include <cstring>
 #include <limits> // std::numeric_limits
-#include <map>
 #include <memory>
 #include <string>
 #include <system_error>
@@ -31,6 +30,7 @@
 #include <jsoncons/utility/binary.hpp>
 #include <jsoncons/utility/unicode_traits.hpp>
 
+#include <jsoncons_ext/cbor/cbor_detail.hpp>
 #include <jsoncons_ext/cbor/cbor_error.hpp>
 #include <jsoncons_ext/cbor/cbor_options.hpp>
 
@@ -57,12 +57,6 @@ public:
     using typename super_type::string_view_type;
 
 private:
-    using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type>;
-    using byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;                  
-
-    using string_type = std::basic_string<char_type,std::char_traits<char_type>,char_allocator_type>;
-    using byte_string_type = basic_byte_string<byte_allocator_type>;
-
     struct stack_item
     {
         cbor_container_type type_;
@@ -98,8 +92,6 @@ private:
 
     };
 
-    using string_size_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::pair<const string_type,size_t>>;
-    using byte_string_size_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::pair<const byte_string_type,size_t>>;
     using stack_item_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<stack_item>;
 
     Sink sink_;
@@ -107,8 +99,7 @@ private:
     allocator_type alloc_;
 
     std::vector<stack_item,stack_item_allocator_type> stack_;
-    std::map<string_type,size_t,std::less<string_type>,string_size_allocator_type> stringref_map_;
-    std::map<byte_string_type,size_t,std::less<byte_string_type>,byte_string_size_allocator_type> bytestringref_map_;
+    jsoncons::cbor::detail::stringref_table<allocator_type> stringref_table_;
     std::size_t next_stringref_ = 0;
     int nesting_depth_{0};
 public:
@@ -129,8 +120,7 @@ public:
          options_(options), 
          alloc_(alloc),
          stack_(alloc),
-         stringref_map_(alloc),
-         bytestringref_map_(alloc)
+         stringref_table_(alloc)
     {
         if (options.pack_strings())
         {
@@ -155,8 +145,7 @@ public:
     void reset()
     {
         stack_.clear();
-        stringref_map_.clear();
-        bytestringref_map_.clear();
+        stringref_table_.clear();
         next_stringref_ = 0;
         nesting_depth_ = 0;
     }
@@ -461,17 +450,16 @@ private:
 
         if (options_.pack_strings() && sv.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
         {
-            string_type s(sv.data(), sv.size(), alloc_);
-            auto it = stringref_map_.find(s);
-            if (it == stringref_map_.end())
+            auto result = stringref_table_.insert(reinterpret_cast<const uint8_t*>(sv.data()), sv.size(), false, next_stringref_);
+            if (result.second)
             {
-                stringref_map_.emplace(std::make_pair(std::move(s), next_stringref_++));
+                ++next_stringref_;
                 write_utf8_string(sv);
             }
             else
             {
                 write_tag(25);
-                write_uint64_value((*it).second);
+                write_uint64_value(result.first);
             }
         }
         else
@@ -1000,17 +988,16 @@ private:
         }
         if (options_.pack_strings() && b.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
         {
-            byte_string_type bs(b.data(), b.size(), alloc_);
-            auto it = bytestringref_map_.find(bs);
-            if (it == bytestringref_map_.end())
+            auto result = stringref_table_.insert(b.data(), b.size(), true, next_stringref_);
+            if (result.second)
             {
-                bytestringref_map_.emplace(std::make_pair(bs, next_stringref_++));
-                write_byte_string(bs);
+                ++next_stringref_;
+                write_byte_string(b);
             }
             else
             {
                 write_tag(25);
-                write_uint64_value((*it).second);
+                write_uint64_value(result.first);
             }
         }
         else
@@ -1029,18 +1016,17 @@ private:
     {
         if (options_.pack_strings() && b.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
         {
-            byte_string_type bs(b.data(), b.size(), alloc_);
-            auto it = bytestringref_map_.find(bs);
-            if (it == bytestringref_map_.end())
+            auto result = stringref_table_.insert(b.data(), b.size(), true, next_stringref_);
+            if (result.second)
             {
-                bytestringref_map_.emplace(std::make_pair(bs, next_stringref_++));
+                ++next_stringref_;
                 write_tag(ext_tag);
-                write_byte_string(bs);
+                write_byte_string(b);
             }
             else
             {
                 write_tag(25);
-                write_uint64_value((*it).second);
+                write_uint64_value(result.first);
             }
         }
         else
@@ -1053,6 +1039,15 @@ private:
         JSONCONS_VISITOR_RETURN;
     }
 
+    // The typed array tags written by this encoder record native byte order, 
+    // so the elements are written as they are, without a temporary copy
+    template <typename T>
+    void write_typed_array_data(const jsoncons::span<const T>& data)
+    {
+        write_byte_string(byte_string_view(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(T)));
+        end_value();
+    }
+
     void write_byte_string(const byte_string_view& b) 
     {
         if (b.size() <= 0x17)
@@ -1090,9 +1085,19 @@ private:
                                             std::back_inserter(sink_));
         }
 
-        for (auto c : b)
+        write_bytes(b.data(), b.size(), ext_traits::has_sink_append<Sink>());
+    }
+
+    void write_bytes(const uint8_t* data, std::size_t length, std::true_type)
+    {
+        sink_.append(data, length);
+    }
+
+    void write_bytes(const uint8_t* data, std::size_t length, std::false_type)
+    {
+        for (std::size_t i = 0; i < length; ++i)
         {
-            sink_.push_back(c);
+            sink_.push_back(data[i]);
         }
     }
 
@@ -1359,6 +1364,7 @@ private:
                     break;
             }
             write_byte_string(byte_string_view(v));
+            end_value();
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1385,9 +1391,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   uint16_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint16_t));
-            std::memcpy(v.data(),data.data(),data.size()*sizeof(uint16_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1414,9 +1418,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   uint32_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint32_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(uint32_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1443,9 +1445,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   uint64_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint64_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(uint64_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1470,9 +1470,7 @@ private:
         if (options_.use_typed_arrays())
         {
             write_tag(0x48);
-            std::vector<uint8_t> v(data.size()*sizeof(int8_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int8_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1499,9 +1497,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   int16_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(int16_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int16_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1528,9 +1524,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   int32_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(int32_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int32_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1557,9 +1551,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   int64_t(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(int64_t));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(int64_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1587,9 +1579,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   half_arg, 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(uint16_t));
-            std::memcpy(v.data(),data.data(),data.size()*sizeof(uint16_t));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1616,9 +1606,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   float(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(float));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(float));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         else
@@ -1645,9 +1633,7 @@ private:
             write_typed_array_tag(std::integral_constant<bool, jsoncons::endian::native == jsoncons::endian::big>(), 
                                   double(), 
                                   tag);
-            std::vector<uint8_t> v(data.size()*sizeof(double));
-            std::memcpy(v.data(), data.data(), data.size()*sizeof(double));
-            write_byte_string(byte_string_view(v));
+            write_typed_array_data(data);
             JSONCONS_VISITOR_RETURN;
         }
         
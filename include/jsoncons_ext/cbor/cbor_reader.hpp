@@ -14,6 +14,7 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <jsoncons/source.hpp>
 
 #include <jsoncons_ext/cbor/cbor_detail.hpp>
@@ -109,6 +110,8 @@ using cbor_stream_reader = basic_cbor_reader<jsoncons::binary_stream_source>;
 
 using cbor_bytes_reader = basic_cbor_reader<jsoncons::bytes_source>;
 
+using cbor_file_reader = basic_cbor_reader<jsoncons::binary_mmap_source>;
+
 } // namespace cbor_reader
 } // namespace jsoncons
 
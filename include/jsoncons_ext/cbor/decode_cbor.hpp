@@ -8,6 +8,7 @@
 #define JSONCONS_EXT_CBOR_DECODE_CBOR_HPP
 
 #include <istream> // std::basic_istream
+#include <string>
 #include <type_traits> // std::enable_if
 #include <vector>
 
@@ -18,6 +19,7 @@
 #include <jsoncons/conv_error.hpp>
 #include <jsoncons/json_filter.hpp>
 #include <jsoncons/reflect/decode_traits.hpp>
+#include <jsoncons/mmap_source.hpp>
 #include <jsoncons/ser_util.hpp>
 #include <jsoncons/source.hpp>
 
@@ -68,7 +70,7 @@ try_decode_cbor(const BytesLike& v,
         return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
     }
 
-    return reflect::decode_traits<T>::try_decode(make_alloc_set(), cursor);
+    return reflect::try_decode_from_cursor<T>(make_alloc_set(), cursor);
 }
 
 template <typename T>
@@ -110,7 +112,49 @@ try_decode_cbor(std::istream& is,
         return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
     }
 
-    return reflect::decode_traits<T>::try_decode(make_alloc_set(), cursor);
+    return reflect::try_decode_from_cursor<T>(make_alloc_set(), cursor);
+}
+
+template <typename T>
+typename std::enable_if<ext_traits::is_basic_json<T>::value,read_result<T>>::type 
+try_decode_cbor(file_path_arg_t, const std::string& path, 
+            const cbor_decode_options& options = cbor_decode_options())
+{
+    using value_type = T;
+    using result_type = read_result<value_type>;
+
+    std::error_code ec;   
+    jsoncons::json_decoder<T> decoder;
+    auto adaptor = make_json_visitor_adaptor<json_visitor>(decoder);
+    cbor_file_reader reader(binary_mmap_source(path), adaptor, options);
+    reader.read(ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return result_type{jsoncons::unexpect, ec, reader.line(), reader.column()};
+    }
+    if (JSONCONS_UNLIKELY(!decoder.is_valid()))
+    {
+        return result_type{jsoncons::unexpect, conv_errc::conversion_failed, reader.line(), reader.column()};
+    }
+    return result_type{decoder.get_result()};
+}
+ 
+template <typename T>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value,read_result<T>>::type 
+try_decode_cbor(file_path_arg_t, const std::string& path, 
+            const cbor_decode_options& options = cbor_decode_options())
+{
+    using value_type = T;
+    using result_type = read_result<value_type>;
+
+    std::error_code ec;
+    basic_cbor_cursor<binary_mmap_source> cursor(binary_mmap_source(path), options, ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
+    }
+
+    return reflect::try_decode_from_cursor<T>(make_alloc_set(), cursor);
 }
 
 template <typename T,typename InputIt>
@@ -152,7 +196,7 @@ try_decode_cbor(InputIt first, InputIt last,
         return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
     }
 
-    return reflect::decode_traits<T>::try_decode(make_alloc_set(), cursor);
+    return reflect::try_decode_from_cursor<T>(make_alloc_set(), cursor);
 }
 
 // With leading allocator_set parameter
@@ -200,7 +244,7 @@ try_decode_cbor(const allocator_set<Alloc,TempAlloc>& aset,
         return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
     }
 
-    return reflect::decode_traits<T>::try_decode(aset, cursor);
+    return reflect::try_decode_from_cursor<T>(aset, cursor);
 }
 
 template <typename T,typename Alloc,typename TempAlloc >
@@ -244,7 +288,7 @@ try_decode_cbor(const allocator_set<Alloc,TempAlloc>& aset,
         return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
     }
 
-    return reflect::decode_traits<T>::try_decode(aset, cursor);
+    return reflect::try_decode_from_cursor<T>(aset, cursor);
 }
 
 template <typename T, typename... Args>
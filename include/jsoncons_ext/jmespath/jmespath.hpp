@@ -13,7 +13,9 @@
 #include <exception>
 #include <functional> // 
 #include <limits> // std::numeric_limits
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <type_traits> // std::is_const
@@ -32,6 +34,10 @@
 
 #include <jsoncons_ext/jmespath/jmespath_error.hpp>
 
+#if !defined(JSONCONS_JMESPATH_DEFAULT_CACHE_CAPACITY)
+#define JSONCONS_JMESPATH_DEFAULT_CACHE_CAPACITY 256
+#endif
+
 namespace jsoncons { 
 namespace jmespath {
 
@@ -5426,43 +5432,6 @@ namespace detail {
     template <typename Json>
     using jmespath_expression = typename jsoncons::jmespath::detail::jmespath_evaluator<Json>::jmespath_expression;
 
-    template <typename Json>
-    Json search(const Json& doc, const typename Json::string_view_type& path)
-    {
-        jsoncons::jmespath::detail::jmespath_evaluator<Json> evaluator;
-        std::error_code ec;
-        auto expr = evaluator.compile(path.data(), path.size(), 
-            jsoncons::jmespath::custom_functions<Json>{}, ec);
-        if (JSONCONS_UNLIKELY(ec))
-        {
-            JSONCONS_THROW(jmespath_error(ec, evaluator.line(), evaluator.column()));
-        }
-        auto result = expr.evaluate(doc, ec);
-        if (JSONCONS_UNLIKELY(ec))
-        {
-            JSONCONS_THROW(jmespath_error(ec));
-        }
-        return result;
-    }
-
-    template <typename Json>
-    Json search(const Json& doc, const typename Json::string_view_type& path, std::error_code& ec)
-    {
-        jsoncons::jmespath::detail::jmespath_evaluator<Json> evaluator;
-        auto expr = evaluator.compile(path.data(), path.size(), 
-            jsoncons::jmespath::custom_functions<Json>{}, ec);
-        if (JSONCONS_UNLIKELY(ec))
-        {
-            return Json::null();
-        }
-        auto result = expr.evaluate(doc, ec);
-        if (JSONCONS_UNLIKELY(ec))
-        {
-            return Json::null();
-        }
-        return result;
-    }
-
     template <typename Json>
     jmespath_expression<Json> make_expression(const typename Json::string_view_type& expr,
         const jsoncons::jmespath::custom_functions<Json>& funcs = jsoncons::jmespath::custom_functions<Json>())
@@ -5495,6 +5464,173 @@ namespace detail {
         return evaluator.compile(expr.data(), expr.size(), funcs, ec);
     }
 
+    // A thread safe, bounded cache of compiled expressions, keyed by expression text,
+    // that evicts the least recently used expression when full. All expressions in a
+    // cache are compiled with the same custom functions.
+    template <typename Json>
+    class expression_cache
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_view_type = typename Json::string_view_type;
+        using expression_type = jmespath_expression<Json>;
+        using expression_pointer = std::shared_ptr<const expression_type>;
+    private:
+        using key_type = std::basic_string<char_type>;
+        using entry_type = std::pair<key_type,expression_pointer>;
+        using list_type = std::list<entry_type>;
+
+        mutable std::mutex mutex_;
+        std::size_t capacity_;
+        custom_functions<Json> functions_;
+        list_type entries_; // most recently used first
+        std::unordered_map<key_type,typename list_type::iterator> index_;
+    public:
+        explicit expression_cache(std::size_t capacity = JSONCONS_JMESPATH_DEFAULT_CACHE_CAPACITY,
+            const custom_functions<Json>& functions = custom_functions<Json>())
+            : capacity_(capacity), functions_(functions)
+        {
+        }
+
+        expression_cache(const expression_cache&) = delete;
+        expression_cache& operator=(const expression_cache&) = delete;
+
+        // Returns the compiled expression for expr, compiling it on a miss.
+        // The expression may be evaluated concurrently from several threads.
+        expression_pointer get(const string_view_type& expr)
+        {
+            key_type key(expr.data(), expr.size());
+            auto compiled = find(key);
+            if (compiled)
+            {
+                return compiled;
+            }
+            // Compile without holding the lock, other threads may look up other expressions meanwhile
+            return insert(std::move(key), std::make_shared<const expression_type>(
+                make_expression<Json>(expr, functions_)));
+        }
+
+        expression_pointer get(const string_view_type& expr, std::error_code& ec)
+        {
+            key_type key(expr.data(), expr.size());
+            auto compiled = find(key);
+            if (compiled)
+            {
+                return compiled;
+            }
+            compiled = std::make_shared<const expression_type>(make_expression<Json>(expr, functions_, ec));
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return expression_pointer();
+            }
+            return insert(std::move(key), std::move(compiled));
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return entries_.size();
+        }
+
+        std::size_t capacity() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return capacity_;
+        }
+
+        void capacity(std::size_t value)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            capacity_ = value;
+            evict();
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            index_.clear();
+            entries_.clear();
+        }
+    private:
+        expression_pointer find(const key_type& key)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(key);
+            if (it == index_.end())
+            {
+                return expression_pointer();
+            }
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->second;
+        }
+
+        expression_pointer insert(key_type&& key, expression_pointer&& compiled)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (capacity_ == 0)
+            {
+                return std::move(compiled);
+            }
+            auto it = index_.find(key);
+            if (it != index_.end())
+            {
+                // Another thread compiled the same expression
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return it->second->second;
+            }
+            entries_.emplace_front(key, std::move(compiled));
+            index_.emplace(std::move(key), entries_.begin());
+            evict();
+            return entries_.front().second;
+        }
+
+        void evict()
+        {
+            while (entries_.size() > capacity_)
+            {
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+    };
+
+    // The cache used by search
+    template <typename Json>
+    expression_cache<Json>& default_expression_cache()
+    {
+        static expression_cache<Json> cache;
+        return cache;
+    }
+
+    template <typename Json>
+    Json search(const Json& doc, const typename Json::string_view_type& path)
+    {
+        auto expr = default_expression_cache<Json>().get(path);
+        std::error_code ec;
+        auto result = expr->evaluate(doc, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(jmespath_error(ec));
+        }
+        return result;
+    }
+
+    template <typename Json>
+    Json search(const Json& doc, const typename Json::string_view_type& path, std::error_code& ec)
+    {
+        auto expr = default_expression_cache<Json>().get(path, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return Json::null();
+        }
+        auto result = expr->evaluate(doc, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return Json::null();
+        }
+        return result;
+    }
+
 } // namespace jmespath
 } // namespace jsoncons
 
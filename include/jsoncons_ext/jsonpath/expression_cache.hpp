@@ -0,0 +1,173 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_JSONPATH_EXPRESSION_CACHE_HPP
+#define JSONCONS_EXT_JSONPATH_EXPRESSION_CACHE_HPP
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility> // std::move
+
+#include <jsoncons/allocator_set.hpp>
+#include <jsoncons/config/compiler_support.hpp>
+
+#include <jsoncons_ext/jsonpath/jsonpath_expression.hpp>
+
+#if !defined(JSONCONS_JSONPATH_DEFAULT_CACHE_CAPACITY)
+#define JSONCONS_JSONPATH_DEFAULT_CACHE_CAPACITY 256
+#endif
+
+namespace jsoncons {
+namespace jsonpath {
+
+    // A thread safe, bounded cache of compiled expressions, keyed by path, that
+    // evicts the least recently used expression when full. All expressions in a
+    // cache are compiled with the same custom functions.
+    template <typename Json>
+    class expression_cache
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_view_type = typename Json::string_view_type;
+        using expression_type = jsonpath_expression<Json>;
+        using expression_pointer = std::shared_ptr<const expression_type>;
+    private:
+        using key_type = std::basic_string<char_type>;
+        using entry_type = std::pair<key_type,expression_pointer>;
+        using list_type = std::list<entry_type>;
+
+        mutable std::mutex mutex_;
+        std::size_t capacity_;
+        custom_functions<Json> functions_;
+        list_type entries_; // most recently used first
+        std::unordered_map<key_type,typename list_type::iterator> index_;
+    public:
+        explicit expression_cache(std::size_t capacity = JSONCONS_JSONPATH_DEFAULT_CACHE_CAPACITY,
+            const custom_functions<Json>& functions = custom_functions<Json>())
+            : capacity_(capacity), functions_(functions)
+        {
+        }
+
+        expression_cache(const expression_cache&) = delete;
+        expression_cache& operator=(const expression_cache&) = delete;
+
+        // Returns the compiled expression for path, compiling it on a miss.
+        // The expression may be evaluated concurrently from several threads.
+        expression_pointer get(const string_view_type& path)
+        {
+            key_type key(path.data(), path.size());
+            auto expr = find(key);
+            if (expr)
+            {
+                return expr;
+            }
+            // Compile without holding the lock, other threads may look up other paths meanwhile
+            return insert(std::move(key), std::make_shared<const expression_type>(
+                make_expression<Json>(jsoncons::make_alloc_set(typename Json::allocator_type()), path, functions_)));
+        }
+
+        expression_pointer get(const string_view_type& path, std::error_code& ec)
+        {
+            key_type key(path.data(), path.size());
+            auto expr = find(key);
+            if (expr)
+            {
+                return expr;
+            }
+            expr = std::make_shared<const expression_type>(
+                make_expression<Json>(jsoncons::make_alloc_set(typename Json::allocator_type()), path, functions_, ec));
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return expression_pointer();
+            }
+            return insert(std::move(key), std::move(expr));
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return entries_.size();
+        }
+
+        std::size_t capacity() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return capacity_;
+        }
+
+        void capacity(std::size_t value)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            capacity_ = value;
+            evict();
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            index_.clear();
+            entries_.clear();
+        }
+    private:
+        expression_pointer find(const key_type& key)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(key);
+            if (it == index_.end())
+            {
+                return expression_pointer();
+            }
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->second;
+        }
+
+        expression_pointer insert(key_type&& key, expression_pointer&& expr)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (capacity_ == 0)
+            {
+                return std::move(expr);
+            }
+            auto it = index_.find(key);
+            if (it != index_.end())
+            {
+                // Another thread compiled the same path
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return it->second->second;
+            }
+            entries_.emplace_front(key, std::move(expr));
+            index_.emplace(std::move(key), entries_.begin());
+            evict();
+            return entries_.front().second;
+        }
+
+        void evict()
+        {
+            while (entries_.size() > capacity_)
+            {
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+    };
+
+    // The cache used by json_query and json_replace when no custom functions are given
+    template <typename Json>
+    expression_cache<Json>& default_expression_cache()
+    {
+        static expression_cache<Json> cache;
+        return cache;
+    }
+
+} // namespace jsonpath
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_JSONPATH_EXPRESSION_CACHE_HPP
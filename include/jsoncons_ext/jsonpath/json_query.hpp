@@ -11,11 +11,13 @@
 
 #include <jsoncons/allocator_set.hpp>
 #include <jsoncons/json_type.hpp>
+#include <jsoncons/lazy_json.hpp>
 #include <jsoncons/reflect/json_conv_traits.hpp>
 #include <jsoncons/semantic_tag.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
 #include <jsoncons_ext/jsonpath/token_evaluator.hpp>
+#include <jsoncons_ext/jsonpath/expression_cache.hpp>
 #include <jsoncons_ext/jsonpath/jsonpath_expression.hpp>
 #include <jsoncons_ext/jsonpath/jsonpath_parser.hpp>
 #include <jsoncons_ext/jsonpath/path_node.hpp>
@@ -47,6 +49,10 @@ namespace jsonpath {
                     result_options options = result_options(),
                     const custom_functions<Json>& functions = custom_functions<Json>())
     {
+        if (functions.begin() == functions.end())
+        {
+            return default_expression_cache<Json>().get(path)->evaluate(root, options);
+        }
         auto expr = make_expression<Json>(path, functions);
         return expr.evaluate(root, options);
     }
@@ -59,6 +65,11 @@ namespace jsonpath {
                result_options options = result_options(),
                const custom_functions<Json>& functions = custom_functions<Json>())
     {
+        if (functions.begin() == functions.end())
+        {
+            default_expression_cache<Json>().get(path)->evaluate(root, callback, options);
+            return;
+        }
         auto expr = make_expression<Json>(path, functions);
         expr.evaluate(root, callback, options);
     }
@@ -85,6 +96,153 @@ namespace jsonpath {
         expr.evaluate(root, callback, options);
     }
 
+    namespace detail {
+
+    // Follows the leading name and index selectors of path, e.g. $.a['b'][0], through
+    // a lazy_json value without decoding anything else. Stops at the first selector
+    // it cannot follow, and returns the position in path where the rest begins.
+    template <typename CharT>
+    std::size_t follow_lazy_prefix(const jsoncons::basic_string_view<CharT>& path, 
+        basic_lazy_json_view<CharT>& current)
+    {
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+
+        std::size_t pos = 0;
+        while (pos < path.size() && (path[pos] == ' ' || path[pos] == '\t' || path[pos] == '\n' || path[pos] == '\r'))
+        {
+            ++pos;
+        }
+        if (pos == path.size() || path[pos] != '$')
+        {
+            return 0;
+        }
+        ++pos;
+        const std::size_t length = path.size();
+        while (pos < length)
+        {
+            const std::size_t start = pos;
+            if (path[pos] == '.')
+            {
+                std::size_t end = pos + 1;
+                while (end < length && ((path[end] >= 'a' && path[end] <= 'z') || (path[end] >= 'A' && path[end] <= 'Z') || 
+                       path[end] == '_' || (end > pos + 1 && path[end] >= '0' && path[end] <= '9')))
+                {
+                    ++end;
+                }
+                if (end == pos + 1 || (end < length && path[end] != '.' && path[end] != '['))
+                {
+                    return start;
+                }
+                string_view_type name(path.data() + pos + 1, end - pos - 1);
+                if (!current.is_object() || !current.contains(name))
+                {
+                    return start;
+                }
+                current = current.at(name);
+                pos = end;
+            }
+            else if (path[pos] == '[' && pos + 1 < length && (path[pos+1] == '\'' || path[pos+1] == '"'))
+            {
+                const CharT quote = path[pos+1];
+                std::size_t end = pos + 2;
+                while (end < length && path[end] != quote && path[end] != '\\')
+                {
+                    ++end;
+                }
+                if (end + 1 >= length || path[end] != quote || path[end+1] != ']')
+                {
+                    return start;
+                }
+                string_view_type name(path.data() + pos + 2, end - pos - 2);
+                if (!current.is_object() || !current.contains(name))
+                {
+                    return start;
+                }
+                current = current.at(name);
+                pos = end + 2;
+            }
+            else if (path[pos] == '[' && pos + 1 < length && path[pos+1] >= '0' && path[pos+1] <= '9')
+            {
+                std::size_t end = pos + 1;
+                std::size_t index = 0;
+                while (end < length && path[end] >= '0' && path[end] <= '9' && end - pos < 10)
+                {
+                    index = index*10 + static_cast<std::size_t>(path[end] - '0');
+                    ++end;
+                }
+                if (end >= length || path[end] != ']' || (path[pos+1] == '0' && end != pos + 2))
+                {
+                    return start;
+                }
+                if (!current.is_array() || index >= current.size())
+                {
+                    return start;
+                }
+                current = current.at(index);
+                pos = end + 1;
+            }
+            else
+            {
+                return start;
+            }
+        }
+        return pos;
+    }
+
+    template <typename Json,typename CharT>
+    struct lazy_query_result
+    {
+        using type = Json;
+    };
+
+    template <typename CharT>
+    struct lazy_query_result<void,CharT>
+    {
+        using type = basic_json<CharT>;
+    };
+
+    } // namespace detail
+
+    // Evaluates path against a lazy_json value. The leading name and index selectors are 
+    // followed through the structural index, and only the value they lead to is decoded 
+    // and queried with the rest of the path. Paths that refer to the root in a filter, 
+    // and queries asking for result paths, decode the whole value.
+    template <typename Json=void,typename CharT>
+    typename detail::lazy_query_result<Json,CharT>::type 
+    json_query(basic_lazy_json_view<CharT> root,
+        const typename basic_lazy_json_view<CharT>::string_view_type& path, 
+        result_options options = result_options())
+    {
+        using value_type = typename detail::lazy_query_result<Json,CharT>::type;
+        using string_type = typename value_type::string_type;
+
+        if ((options & result_options::path) == result_options::path)
+        {
+            return json_query(root.template as<value_type>(), path, options);
+        }
+
+        basic_lazy_json_view<CharT> current = root;
+        std::size_t pos = detail::follow_lazy_prefix(path, current);
+        if (pos == 0)
+        {
+            return json_query(root.template as<value_type>(), path, options);
+        }
+        if (path.find('$', pos) != jsoncons::basic_string_view<CharT>::npos)
+        {
+            return json_query(root.template as<value_type>(), path, options);
+        }
+        if (pos == path.size())
+        {
+            value_type result(json_array_arg);
+            result.push_back(current.template as<value_type>());
+            return result;
+        }
+        string_type rest;
+        rest.push_back('$');
+        rest.append(path.data() + pos, path.size() - pos);
+        return json_query(current.template as<value_type>(), rest, options);
+    }
+
     template <typename Json,typename T>
     typename std::enable_if<reflect::is_json_conv_traits_specialized<Json,T>::value,void>::type
         json_replace(Json& root, const typename Json::string_view_type& path, T&& new_value,
@@ -98,16 +256,22 @@ namespace jsonpath {
         using path_expression_type = typename jsonpath_traits_type::path_expression_type;
         using path_node_type = typename jsonpath_traits_type::path_node_type;
 
-        auto resources = jsoncons::make_unique<jsoncons::jsonpath::detail::static_resources<value_type>>(funcs);
-        evaluator_type evaluator;
-        path_expression_type expr = evaluator.compile(*resources, path);
-
-        jsoncons::jsonpath::detail::eval_context<Json,reference> context;
         auto callback = [&new_value](const path_node_type&, reference v)
         {
             v = std::forward<T>(new_value);
         };
 
+        if (funcs.begin() == funcs.end())
+        {
+            default_expression_cache<Json>().get(path)->update(root, callback);
+            return;
+        }
+
+        auto resources = jsoncons::make_unique<jsoncons::jsonpath::detail::static_resources<value_type>>(funcs);
+        evaluator_type evaluator;
+        path_expression_type expr = evaluator.compile(*resources, path);
+
+        jsoncons::jsonpath::detail::eval_context<Json,reference> context;
         result_options options = result_options::nodups | result_options::path | result_options::sort_descending;
         expr.evaluate(context, root, path_node_type{}, root, callback, options);
     }
@@ -152,16 +316,22 @@ namespace jsonpath {
         using path_expression_type = typename jsonpath_traits_type::path_expression_type;
         using path_node_type = typename jsonpath_traits_type::path_node_type;
 
+        auto f = [&callback](const path_node_type& path, reference val)
+        {
+            callback(to_basic_string(path), val);
+        };
+
+        if (funcs.begin() == funcs.end())
+        {
+            default_expression_cache<Json>().get(path)->update(root, f);
+            return;
+        }
+
         auto resources = jsoncons::make_unique<jsoncons::jsonpath::detail::static_resources<value_type>>(funcs);
         evaluator_type evaluator;
         path_expression_type expr = evaluator.compile(*resources, path);
 
         jsoncons::jsonpath::detail::eval_context<Json,reference> context;
-
-        auto f = [&callback](const path_node_type& path, reference val)
-        {
-            callback(to_basic_string(path), val);
-        };
         result_options options = result_options::nodups | result_options::path | result_options::sort_descending;
         expr.evaluate(context, root, path_node_type{}, root, f, options);
     }
@@ -201,23 +371,14 @@ namespace jsonpath {
     {
         using jsonpath_traits_type = jsoncons::jsonpath::legacy_jsonpath_traits<Json, Json&>;
 
-        using value_type = typename jsonpath_traits_type::value_type;
         using reference = typename jsonpath_traits_type::reference;
-        using evaluator_type = typename jsonpath_traits_type::evaluator_type;
-        using path_expression_type = typename jsonpath_traits_type::path_expression_type;
         using path_node_type = typename jsonpath_traits_type::path_node_type;
 
-        auto resources = jsoncons::make_unique<jsoncons::jsonpath::detail::static_resources<value_type>>();
-        evaluator_type evaluator;
-        path_expression_type expr = evaluator.compile(*resources, path);
-
-        jsoncons::jsonpath::detail::eval_context<Json,reference> context;
         auto f = [callback](const path_node_type&, reference v)
         {
             v = callback(v);
         };
-        result_options options = result_options::nodups | result_options::path | result_options::sort_descending;
-        expr.evaluate(context, root, path_node_type{}, root, f, options);
+        default_expression_cache<Json>().get(path)->update(root, f);
     }
 
 } // namespace jsonpath
@@ -59,7 +59,8 @@ namespace jsonpath {
         expected_and,
         expected_comma_or_rparen,
         expected_comma_or_rbracket,
-        expected_relative_path
+        expected_relative_path,
+        invalid_regex
     };
 
     class jsonpath_error_category_impl
@@ -150,6 +151,8 @@ namespace jsonpath {
                     return "Expected comma or right bracket";
                 case jsonpath_errc::expected_relative_path:
                     return "Expected unquoted string, or single or double quoted string, or index or '*'";
+                case jsonpath_errc::invalid_regex:
+                    return "Invalid regular expression";
                 default:
                     return "Unknown jsonpath parser error";
             }
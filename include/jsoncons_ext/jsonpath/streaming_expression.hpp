@@ -0,0 +1,800 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_JSONPATH_STREAMING_EXPRESSION_HPP
+#define JSONCONS_EXT_JSONPATH_STREAMING_EXPRESSION_HPP
+
+#include <algorithm> // std::find
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons/utility/read_number.hpp>
+
+#include <jsoncons_ext/jsonpath/json_location.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_expression.hpp>
+#include <jsoncons_ext/jsonpath/path_node.hpp>
+
+namespace jsoncons {
+namespace jsonpath {
+
+namespace detail {
+
+    enum class streaming_step_kind
+    {
+        selector,    // names, indices, a slice or a wildcard, matched against each child
+        filter_tail, // a filter and the rest of the path, evaluated on each child once decoded
+        node_tail    // the rest of the path, evaluated on the node once decoded
+    };
+
+    template <typename Json>
+    struct streaming_step
+    {
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+
+        streaming_step_kind kind{streaming_step_kind::selector};
+        bool descendant{false};
+        bool wildcard{false};
+        std::vector<string_type> names;
+        std::vector<std::size_t> indices;
+        bool is_slice{false};
+        std::size_t slice_start{0};
+        std::size_t slice_stop{(std::numeric_limits<std::size_t>::max)()};
+        std::size_t slice_step{1};
+        std::shared_ptr<const jsonpath_expression<Json>> tail;
+
+        bool matches(const string_view_type& name) const
+        {
+            if (wildcard)
+            {
+                return true;
+            }
+            for (const auto& s : names)
+            {
+                if (s.size() == name.size() && std::char_traits<char_type>::compare(s.data(), name.data(), name.size()) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool matches(std::size_t index) const
+        {
+            if (wildcard)
+            {
+                return true;
+            }
+            if (is_slice)
+            {
+                return index >= slice_start && index < slice_stop && (index - slice_start) % slice_step == 0;
+            }
+            return std::find(indices.begin(), indices.end(), index) != indices.end();
+        }
+    };
+
+    // Splits a valid JSONPath expression into the steps that can be matched against
+    // cursor events. Parsing stops at the first step that is not a name, index, slice
+    // or wildcard selector, the rest of the path becomes a filter or node tail.
+    template <typename Json>
+    class streaming_path_parser
+    {
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+        using step_type = streaming_step<Json>;
+
+        string_view_type path_;
+        std::size_t pos_{0};
+    public:
+        explicit streaming_path_parser(const string_view_type& path)
+            : path_(path)
+        {
+        }
+
+        std::vector<step_type> parse()
+        {
+            std::vector<step_type> steps;
+
+            skip_whitespace();
+            if (pos_ == path_.size() || path_[pos_] != '$')
+            {
+                steps.push_back(make_tail(streaming_step_kind::node_tail, 0, false));
+                return steps;
+            }
+            ++pos_;
+            while (pos_ < path_.size())
+            {
+                const std::size_t start = pos_;
+                step_type step;
+                bool ok = false;
+                if (path_[pos_] == '.')
+                {
+                    ++pos_;
+                    if (pos_ < path_.size() && path_[pos_] == '.')
+                    {
+                        step.descendant = true;
+                        ++pos_;
+                        ok = pos_ < path_.size() && path_[pos_] == '[' ? parse_bracket(step) : parse_dot_name(step);
+                    }
+                    else
+                    {
+                        ok = parse_dot_name(step);
+                    }
+                }
+                else if (path_[pos_] == '[')
+                {
+                    ok = parse_bracket(step);
+                }
+                if (!ok)
+                {
+                    steps.push_back(make_tail(streaming_step_kind::node_tail, start, false));
+                    break;
+                }
+                steps.push_back(std::move(step));
+                if (steps.back().kind == streaming_step_kind::filter_tail)
+                {
+                    break;
+                }
+            }
+            return steps;
+        }
+
+    private:
+        void skip_whitespace()
+        {
+            while (pos_ < path_.size() && (path_[pos_] == ' ' || path_[pos_] == '\t' || path_[pos_] == '\r' || path_[pos_] == '\n'))
+            {
+                ++pos_;
+            }
+        }
+
+        static bool is_digit(char_type c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        static bool is_name_char(char_type c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || is_digit(c) || c == '_' ||
+                static_cast<typename std::make_unsigned<char_type>::type>(c) >= 0x80;
+        }
+
+        step_type make_tail(streaming_step_kind kind, std::size_t start, bool descendant)
+        {
+            step_type step;
+            step.kind = kind;
+            step.descendant = descendant;
+            string_type tail;
+            if (start == 0)
+            {
+                tail.append(path_.data(), path_.size());
+            }
+            else
+            {
+                tail.push_back('$');
+                tail.append(path_.data() + start, path_.size() - start);
+            }
+            std::error_code ec;
+            step.tail = std::make_shared<const jsonpath_expression<Json>>(make_expression<Json>(string_view_type(tail), ec));
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                step.tail.reset();
+            }
+            return step;
+        }
+
+        // A name may also select an array element
+        bool add_name(step_type& step, string_type&& name)
+        {
+            static const char_type length_label[] = {'l','e','n','g','t','h'};
+            if (name.size() == 6 && std::char_traits<char_type>::compare(name.data(), length_label, 6) == 0)
+            {
+                return false;
+            }
+            if (!name.empty() && std::all_of(name.begin(), name.end(), is_digit))
+            {
+                std::size_t index{0};
+                if (!jsoncons::utility::dec_to_integer(name.data(), name.size(), index))
+                {
+                    return false;
+                }
+                step.indices.push_back(index);
+            }
+            else if (!name.empty() && name[0] == '-')
+            {
+                return false;
+            }
+            step.names.push_back(std::move(name));
+            return true;
+        }
+
+        bool parse_dot_name(step_type& step)
+        {
+            if (pos_ < path_.size() && path_[pos_] == '*')
+            {
+                ++pos_;
+                step.wildcard = true;
+                return true;
+            }
+            const std::size_t start = pos_;
+            while (pos_ < path_.size() && is_name_char(path_[pos_]))
+            {
+                ++pos_;
+            }
+            if (pos_ == start || (pos_ < path_.size() && path_[pos_] != '.' && path_[pos_] != '['))
+            {
+                return false;
+            }
+            return add_name(step, string_type(path_.data() + start, pos_ - start));
+        }
+
+        bool parse_integer(std::size_t& value)
+        {
+            const std::size_t start = pos_;
+            while (pos_ < path_.size() && is_digit(path_[pos_]))
+            {
+                ++pos_;
+            }
+            return pos_ != start && jsoncons::utility::dec_to_integer(path_.data() + start, pos_ - start, value);
+        }
+
+        bool parse_slice(step_type& step)
+        {
+            // pos_ is at the first ':'
+            step.is_slice = true;
+            ++pos_;
+            skip_whitespace();
+            if (pos_ < path_.size() && is_digit(path_[pos_]))
+            {
+                if (!parse_integer(step.slice_stop))
+                {
+                    return false;
+                }
+                skip_whitespace();
+            }
+            if (pos_ < path_.size() && path_[pos_] == ':')
+            {
+                ++pos_;
+                skip_whitespace();
+                if (pos_ < path_.size() && is_digit(path_[pos_]))
+                {
+                    if (!parse_integer(step.slice_step) || step.slice_step == 0)
+                    {
+                        return false;
+                    }
+                    skip_whitespace();
+                }
+            }
+            return pos_ < path_.size() && path_[pos_] == ']';
+        }
+
+        bool parse_bracket(step_type& step)
+        {
+            // pos_ is at '['
+            const std::size_t bracket = pos_;
+            ++pos_;
+            skip_whitespace();
+            if (pos_ == path_.size())
+            {
+                return false;
+            }
+            if (path_[pos_] == '?')
+            {
+                step = make_tail(streaming_step_kind::filter_tail, bracket, step.descendant);
+                pos_ = path_.size();
+                return true;
+            }
+            if (path_[pos_] == '*')
+            {
+                ++pos_;
+                skip_whitespace();
+                if (pos_ == path_.size() || path_[pos_] != ']')
+                {
+                    return false;
+                }
+                ++pos_;
+                step.wildcard = true;
+                return true;
+            }
+            if (path_[pos_] == ':')
+            {
+                if (!parse_slice(step))
+                {
+                    return false;
+                }
+                ++pos_;
+                return true;
+            }
+            while (true)
+            {
+                if (pos_ == path_.size())
+                {
+                    return false;
+                }
+                const char_type c = path_[pos_];
+                if (c == '\'' || c == '"')
+                {
+                    const std::size_t start = ++pos_;
+                    while (pos_ < path_.size() && path_[pos_] != c && path_[pos_] != '\\')
+                    {
+                        ++pos_;
+                    }
+                    if (pos_ == path_.size() || path_[pos_] != c)
+                    {
+                        return false;
+                    }
+                    if (!add_name(step, string_type(path_.data() + start, pos_ - start)))
+                    {
+                        return false;
+                    }
+                    ++pos_;
+                }
+                else if (is_digit(c))
+                {
+                    std::size_t index{0};
+                    if (!parse_integer(index))
+                    {
+                        return false;
+                    }
+                    skip_whitespace();
+                    if (pos_ < path_.size() && path_[pos_] == ':')
+                    {
+                        if (!step.indices.empty() || !step.names.empty())
+                        {
+                            return false;
+                        }
+                        step.slice_start = index;
+                        if (!parse_slice(step))
+                        {
+                            return false;
+                        }
+                        ++pos_;
+                        return true;
+                    }
+                    step.indices.push_back(index);
+                }
+                else
+                {
+                    return false;
+                }
+                skip_whitespace();
+                if (pos_ == path_.size())
+                {
+                    return false;
+                }
+                if (path_[pos_] == ']')
+                {
+                    ++pos_;
+                    return true;
+                }
+                if (path_[pos_] != ',')
+                {
+                    return false;
+                }
+                ++pos_;
+                skip_whitespace();
+            }
+        }
+    };
+
+    // Matches the steps of a streaming_expression against the events of one document.
+    // Values are decoded only when they are selected, or when a tail must be evaluated on them.
+    template <typename Json>
+    class streaming_evaluator
+    {
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+        using step_type = streaming_step<Json>;
+        using path_element_type = basic_path_element<char_type,std::allocator<char_type>>;
+        using location_type = basic_json_location<char_type>;
+        using path_node_type = basic_path_node<char_type>;
+
+        struct frame
+        {
+            bool is_object;
+            std::size_t index;
+            std::vector<std::size_t> states;
+        };
+
+        struct capture
+        {
+            std::size_t depth;
+            std::vector<path_element_type> location;
+            bool emit;
+            std::vector<const step_type*> node_tails;
+            std::vector<const step_type*> filter_tails;
+            json_decoder<Json> decoder;
+
+            capture(std::size_t depth, const std::vector<path_element_type>& location)
+                : depth(depth), location(location), emit(false)
+            {
+            }
+        };
+
+        const std::vector<step_type>& steps_;
+        std::vector<frame> frames_;
+        std::vector<path_element_type> location_;
+        std::vector<std::unique_ptr<capture>> captures_;
+        string_type key_;
+    public:
+        explicit streaming_evaluator(const std::vector<step_type>& steps)
+            : steps_(steps)
+        {
+        }
+
+        template <typename BinaryCallback>
+        void evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback& callback, std::error_code& ec)
+        {
+            bool done = cursor.done();
+            while (!done)
+            {
+                const auto& event = cursor.current();
+                switch (event.event_type())
+                {
+                    case staj_event_type::key:
+                        key_ = string_type(event.template get<string_view_type>());
+                        forward(event, cursor, ec);
+                        break;
+                    case staj_event_type::end_object:
+                    case staj_event_type::end_array:
+                        forward(event, cursor, ec);
+                        frames_.pop_back();
+                        done = end_value(callback);
+                        break;
+                    default:
+                        done = begin_value(event, cursor, callback, ec);
+                        break;
+                }
+                if (done || JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+                cursor.next(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+            }
+        }
+
+    private:
+        static void add_state(std::vector<std::size_t>& states, std::size_t k)
+        {
+            if (std::find(states.begin(), states.end(), k) == states.end())
+            {
+                states.push_back(k);
+            }
+        }
+
+        static void add_step(std::vector<const step_type*>& steps, const step_type* step)
+        {
+            if (std::find(steps.begin(), steps.end(), step) == steps.end())
+            {
+                steps.push_back(step);
+            }
+        }
+
+        void forward(const basic_staj_event<char_type>& event, basic_staj_cursor<char_type>& cursor, std::error_code& ec)
+        {
+            for (auto& c : captures_)
+            {
+                event.send_json_event(c->decoder, cursor.context(), ec);
+            }
+        }
+
+        template <typename BinaryCallback>
+        bool begin_value(const basic_staj_event<char_type>& event, basic_staj_cursor<char_type>& cursor,
+            BinaryCallback& callback, std::error_code& ec)
+        {
+            std::vector<std::size_t> states;
+            std::vector<const step_type*> filter_tails;
+            if (frames_.empty())
+            {
+                states.push_back(0);
+            }
+            else
+            {
+                frame& parent = frames_.back();
+                if (parent.is_object)
+                {
+                    location_.emplace_back(key_.data(), key_.size());
+                }
+                else
+                {
+                    location_.emplace_back(parent.index);
+                }
+                for (std::size_t k : parent.states)
+                {
+                    const step_type& step = steps_[k];
+                    if (step.descendant)
+                    {
+                        add_state(states, k);
+                    }
+                    if (step.kind == streaming_step_kind::filter_tail)
+                    {
+                        add_step(filter_tails, &step);
+                    }
+                    else if (parent.is_object ? step.matches(string_view_type(key_)) : step.matches(parent.index))
+                    {
+                        add_state(states, k + 1);
+                    }
+                }
+                ++parent.index;
+            }
+
+            bool emit = false;
+            std::vector<const step_type*> node_tails;
+            std::vector<std::size_t> descend;
+            for (std::size_t k : states)
+            {
+                if (k == steps_.size())
+                {
+                    emit = true;
+                }
+                else if (steps_[k].kind == streaming_step_kind::node_tail)
+                {
+                    add_step(node_tails, &steps_[k]);
+                }
+                else
+                {
+                    descend.push_back(k);
+                }
+            }
+            if (emit || !node_tails.empty() || !filter_tails.empty())
+            {
+                captures_.push_back(jsoncons::make_unique<capture>(frames_.size(), location_));
+                capture& c = *captures_.back();
+                c.emit = emit;
+                c.node_tails = std::move(node_tails);
+                c.filter_tails = std::move(filter_tails);
+            }
+
+            forward(event, cursor, ec);
+            if (is_begin_container(event.event_type()))
+            {
+                if (descend.empty() && captures_.empty())
+                {
+                    skip_container(cursor, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return true;
+                    }
+                    return end_value(callback);
+                }
+                frames_.push_back(frame{event.event_type() == staj_event_type::begin_object, 0, std::move(descend)});
+                return false;
+            }
+            return end_value(callback);
+        }
+
+        // Reads to the end of a container that nothing below can match
+        void skip_container(basic_staj_cursor<char_type>& cursor, std::error_code& ec)
+        {
+            std::size_t level = 1;
+            while (level > 0 && !cursor.done())
+            {
+                cursor.next(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+                switch (cursor.current().event_type())
+                {
+                    case staj_event_type::begin_object:
+                    case staj_event_type::begin_array:
+                        ++level;
+                        break;
+                    case staj_event_type::end_object:
+                    case staj_event_type::end_array:
+                        --level;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        // Completes the captures of the value that just ended, returns true at the end of the document
+        template <typename BinaryCallback>
+        bool end_value(BinaryCallback& callback)
+        {
+            const std::size_t depth = frames_.size();
+            while (!captures_.empty() && captures_.back()->depth == depth)
+            {
+                std::unique_ptr<capture> c = std::move(captures_.back());
+                captures_.pop_back();
+                complete(*c, callback);
+            }
+            if (depth == 0)
+            {
+                return true;
+            }
+            location_.pop_back();
+            return false;
+        }
+
+        template <typename BinaryCallback>
+        void complete(capture& c, BinaryCallback& callback)
+        {
+            Json value = c.decoder.get_result();
+            if (c.emit)
+            {
+                const location_type location(std::vector<path_element_type>(c.location));
+                callback(location, value);
+            }
+            for (const step_type* step : c.node_tails)
+            {
+                step->tail->select(value,
+                    [&](const path_node_type& path, const Json& val)
+                    {
+                        callback(make_location(c.location, path, false), val);
+                    });
+            }
+            if (!c.filter_tails.empty())
+            {
+                // The filter selects the value if it selects it in an array that holds only the value
+                Json wrapper(json_array_arg);
+                wrapper.push_back(std::move(value));
+                for (const step_type* step : c.filter_tails)
+                {
+                    step->tail->select(wrapper,
+                        [&](const path_node_type& path, const Json& val)
+                        {
+                            callback(make_location(c.location, path, true), val);
+                        });
+                }
+            }
+        }
+
+        static location_type make_location(const std::vector<path_element_type>& prefix, const path_node_type& path, bool skip_first)
+        {
+            const location_type relative(path);
+            std::vector<path_element_type> elements(prefix);
+            auto it = relative.begin();
+            if (skip_first && it != relative.end())
+            {
+                ++it;
+            }
+            elements.insert(elements.end(), it, relative.end());
+            return location_type(std::move(elements));
+        }
+    };
+
+} // namespace detail
+
+    // The compiled form of a JSONPath expression that is evaluated on the events of a cursor.
+    template <typename Json>
+    class streaming_expression
+    {
+    public:
+        using value_type = Json;
+        using char_type = typename Json::char_type;
+        using string_view_type = typename Json::string_view_type;
+        using location_type = basic_json_location<char_type>;
+    private:
+        using step_type = detail::streaming_step<Json>;
+
+        std::vector<step_type> steps_;
+    public:
+        explicit streaming_expression(std::vector<step_type>&& steps)
+            : steps_(std::move(steps))
+        {
+        }
+
+        streaming_expression(const streaming_expression&) = default;
+        streaming_expression(streaming_expression&&) = default;
+
+        streaming_expression& operator=(const streaming_expression&) = default;
+        streaming_expression& operator=(streaming_expression&&) = default;
+
+        // True if no part of the path needs a decoded container, other than
+        // the elements and members tested by a filter
+        bool is_streamable() const
+        {
+            for (const auto& step : steps_)
+            {
+                if (step.kind == detail::streaming_step_kind::node_tail)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename BinaryCallback>
+        void evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback) const
+        {
+            std::error_code ec;
+            evaluate(cursor, callback, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+            }
+        }
+
+        template <typename BinaryCallback>
+        void evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback, std::error_code& ec) const
+        {
+            detail::streaming_evaluator<Json> evaluator(steps_);
+            evaluator.evaluate(cursor, callback, ec);
+        }
+    };
+
+    template <typename Json>
+    streaming_expression<Json> make_streaming_expression(const typename Json::string_view_type& path,
+        std::error_code& ec)
+    {
+        using step_type = detail::streaming_step<Json>;
+
+        // Checks the syntax of the whole path
+        make_expression<Json>(path, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return streaming_expression<Json>(std::vector<step_type>{});
+        }
+
+        detail::streaming_path_parser<Json> parser(path);
+        std::vector<step_type> steps = parser.parse();
+
+        // A tail that refers to the root, or that failed to compile on its own,
+        // is replaced by the whole path evaluated on the decoded document
+        for (const auto& step : steps)
+        {
+            if (step.kind != detail::streaming_step_kind::selector &&
+                (!step.tail || path.find('$', path.find('$') + 1) != Json::string_view_type::npos))
+            {
+                std::vector<step_type> whole;
+                whole.emplace_back();
+                whole.back().kind = detail::streaming_step_kind::node_tail;
+                whole.back().tail = std::make_shared<const jsonpath_expression<Json>>(make_expression<Json>(path));
+                return streaming_expression<Json>(std::move(whole));
+            }
+        }
+        return streaming_expression<Json>(std::move(steps));
+    }
+
+    template <typename Json>
+    streaming_expression<Json> make_streaming_expression(const typename Json::string_view_type& path)
+    {
+        std::error_code ec;
+        auto expr = make_streaming_expression<Json>(path, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(jsonpath_error(ec));
+        }
+        return expr;
+    }
+
+    // Calls callback(const basic_json_location<char_type>&, const Json&) for each value
+    // in the document at the cursor that path selects, as soon as the value has been read
+    template <typename Json,typename BinaryCallback>
+    void stream_query(basic_staj_cursor<typename Json::char_type>& cursor,
+        const typename Json::string_view_type& path,
+        BinaryCallback callback)
+    {
+        auto expr = make_streaming_expression<Json>(path);
+        expr.evaluate(cursor, callback);
+    }
+
+} // namespace jsonpath
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_JSONPATH_STREAMING_EXPRESSION_HPP
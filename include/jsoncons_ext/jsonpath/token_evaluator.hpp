@@ -25,14 +25,11 @@
 #include <jsoncons/json_type.hpp>
 #include <jsoncons/semantic_tag.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
+#include <jsoncons/utility/regex.hpp>
 
 #include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
 #include <jsoncons_ext/jsonpath/path_node.hpp>
 
-#if defined(JSONCONS_HAS_STD_REGEX)
-#include <regex>
-#endif
-
 namespace jsoncons { 
 namespace jsonpath {
 
@@ -507,10 +504,10 @@ namespace detail {
     {
         using const_reference = typename jsonpath_traits<Json>::const_reference;
         using char_type = typename Json::char_type;
-        using string_type = typename Json::string_type;
-        std::basic_regex<char_type> pattern_;
+        using string_view_type = typename Json::string_view_type;
+        basic_regex_pattern<char_type> pattern_;
     public:
-        regex_operator(std::basic_regex<char_type>&& pattern)
+        regex_operator(basic_regex_pattern<char_type>&& pattern)
             : unary_operator<Json>(2, true),
               pattern_(std::move(pattern))
         {
@@ -522,7 +519,7 @@ namespace detail {
             {
                 return Json::null();
             }
-            return std::regex_search(val.as_string(), pattern_) ? Json(true, semantic_tag::none) : Json(false, semantic_tag::none);
+            return pattern_.search(val.template as<string_view_type>()) ? Json(true, semantic_tag::none) : Json(false, semantic_tag::none);
         }
     };
 
@@ -1358,8 +1355,6 @@ namespace detail {
         }
     };
 
-#if defined(JSONCONS_HAS_STD_REGEX)
-
     template <typename Json>
     class tokenize_function : public function_base<Json>
     {
@@ -1397,21 +1392,29 @@ namespace detail {
             auto arg0 = args[0].value().template as<string_view_type>();
             auto arg1 = args[1].value().template as<string_view_type>();
 
-            auto s0 = string_type(arg0.begin(), arg0.end(), alloc_);
-            auto s1 = string_type(arg1.begin(), arg1.end(), alloc_);
-
-            std::regex::flag_type options = std::regex_constants::ECMAScript; 
-            std::basic_regex<char_type> pieces_regex(s1, options);
-
-            std::regex_token_iterator<typename string_type::const_iterator> rit ( s0.begin(), s0.end(), pieces_regex, -1);
-            std::regex_token_iterator<typename string_type::const_iterator> rend;
+            std::error_code regex_ec;
+            auto pieces_regex = basic_regex_pattern<char_type>::compile(arg1, regex_options::none, regex_ec);
+            if (JSONCONS_UNLIKELY(regex_ec))
+            {
+                ec = jsonpath_errc::invalid_regex;
+                return value_type::null();
+            }
 
+            // The pieces between matches, as std::regex_token_iterator with submatch -1
             value_type j(json_array_arg, semantic_tag::none, alloc_);
-            while (rit != rend) 
+            std::size_t pos = 0;
+            std::size_t prev = 0;
+            std::size_t first = 0;
+            std::size_t last = 0;
+            while (pos <= arg0.size() && pieces_regex.search(arg0, pos, first, last))
             {
-                auto s = (*rit).str();
-                j.emplace_back(s.c_str(), semantic_tag::none);
-                ++rit;
+                j.emplace_back(string_view_type(arg0.data() + prev, first - prev), semantic_tag::none);
+                prev = last;
+                pos = last == first ? last + 1 : last;
+            }
+            if (prev < arg0.size())
+            {
+                j.emplace_back(string_view_type(arg0.data() + prev, arg0.size() - prev), semantic_tag::none);
             }
             return j;
         }
@@ -1429,8 +1432,6 @@ namespace detail {
         }
     };
 
-#endif // defined(JSONCONS_HAS_STD_REGEX)
-
     template <typename Json>
     class ceil_function : public function_base<Json>
     {
@@ -2477,10 +2478,8 @@ namespace detail {
                     jsoncons::make_unique<length_function<Json>>());
                 functions_.emplace(string_type{ JSONCONS_CSTRING_CONSTANT(char_type, "keys"), alloc_ },
                     jsoncons::make_unique<keys_function<Json>>(alloc_));
-#if defined(JSONCONS_HAS_STD_REGEX)
                 functions_.emplace(string_type{ JSONCONS_CSTRING_CONSTANT(char_type, "tokenize"), alloc_ },
                     jsoncons::make_unique<tokenize_function<Json>>(alloc_));
-#endif
                 functions_.emplace(string_type{JSONCONS_CSTRING_CONSTANT(char_type, "count"), alloc_}, 
                     jsoncons::make_unique<length_function<Json>>());
         }
@@ -2529,7 +2528,7 @@ namespace detail {
             return &oper;
         }
 
-        const unary_operator<Json>* get_regex_operator(std::basic_regex<char_type>&& pattern) 
+        const unary_operator<Json>* get_regex_operator(basic_regex_pattern<char_type>&& pattern) 
         {
             unary_operators_.push_back(jsoncons::make_unique<regex_operator<Json>>(std::move(pattern)));
             return unary_operators_.back().get();
@@ -18,6 +18,7 @@
 
 #include <jsoncons/utility/write_number.hpp>
 #include <jsoncons/json_type.hpp>
+#include <jsoncons/lazy_json.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
 #include <jsoncons_ext/jsonpointer/jsonpointer_error.hpp>
@@ -638,6 +639,94 @@ namespace jsonpointer {
         return j;
     }
 
+    // get, for a lazy_json value
+
+    template <typename CharT>
+    basic_lazy_json_view<CharT> get(basic_lazy_json_view<CharT> root, 
+        const basic_json_pointer<CharT>& location, 
+        std::error_code& ec)
+    {
+        basic_lazy_json_view<CharT> current = root;
+        for (const auto& token : location)
+        {
+            if (current.is_array())
+            {
+                if (token.size() == 1 && token[0] == '-')
+                {
+                    ec = jsonpointer_errc::index_exceeds_array_size;
+                    return current;
+                }
+                std::size_t index{0};
+                auto result = jsoncons::utility::dec_to_integer(token.data(), token.length(), index);
+                if (!result)
+                {
+                    ec = jsonpointer_errc::invalid_index;
+                    return current;
+                }
+                if (index >= current.size())
+                {
+                    ec = jsonpointer_errc::index_exceeds_array_size;
+                    return current;
+                }
+                current = current.at(index);
+            }
+            else if (current.is_object())
+            {
+                if (!current.contains(token))
+                {
+                    ec = jsonpointer_errc::key_not_found;
+                    return current;
+                }
+                current = current.at(token);
+            }
+            else
+            {
+                ec = jsonpointer_errc::expected_object_or_array;
+                return current;
+            }
+        }
+        return current;
+    }
+
+    template <typename CharT,typename StringSource>
+    typename std::enable_if<std::is_convertible<StringSource,jsoncons::basic_string_view<CharT>>::value,basic_lazy_json_view<CharT>>::type
+    get(basic_lazy_json_view<CharT> root, 
+        const StringSource& location_str, 
+        std::error_code& ec)
+    {
+        auto jsonptr = basic_json_pointer<CharT>::parse(location_str, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return root;
+        }
+        return get(root, jsonptr, ec);
+    }
+
+    template <typename CharT>
+    basic_lazy_json_view<CharT> get(basic_lazy_json_view<CharT> root, const basic_json_pointer<CharT>& location)
+    {
+        std::error_code ec;
+        auto result = get(root, location, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+        return result;
+    }
+
+    template <typename CharT,typename StringSource>
+    typename std::enable_if<std::is_convertible<StringSource,jsoncons::basic_string_view<CharT>>::value,basic_lazy_json_view<CharT>>::type
+    get(basic_lazy_json_view<CharT> root, const StringSource& location_str)
+    {
+        std::error_code ec;
+        auto result = get(root, location_str, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+        return result;
+    }
+
     // contains
 
     template <typename Json>
@@ -69,27 +69,35 @@ namespace jsonschema {
         std::vector<const schema_validator<Json>*> dynamic_scope_;
         jsonpointer::json_pointer eval_path_;
         evaluation_flags flags_;
+        bool record_paths_;
     public:
         eval_context()
-            : flags_{}
+            : flags_{}, record_paths_(true)
+        {
+        }
+
+        // If record_paths is false, evaluation and instance paths are left empty,
+        // for when only a valid or invalid result is needed
+        explicit eval_context(bool record_paths)
+            : flags_{}, record_paths_(record_paths)
         {
         }
 
         eval_context(const eval_context& other)
             : dynamic_scope_ { other.dynamic_scope_}, eval_path_{other.eval_path_},
-              flags_(other.flags_)
+              flags_(other.flags_), record_paths_(other.record_paths_)
         {
         }
 
         eval_context(eval_context&& other) noexcept
             : dynamic_scope_{std::move(other.dynamic_scope_)},eval_path_{std::move(other.eval_path_)},
-              flags_(other.flags_)
+              flags_(other.flags_), record_paths_(other.record_paths_)
         {
         }
 
         eval_context(const eval_context& parent, const schema_validator<Json> *validator)
             : dynamic_scope_ { parent.dynamic_scope_ }, eval_path_{ parent.eval_path_ },
-              flags_(parent.flags_)
+              flags_(parent.flags_), record_paths_(parent.record_paths_)
         {
             if (validator->id() || dynamic_scope_.empty())
             {
@@ -100,7 +108,7 @@ namespace jsonschema {
         eval_context(const eval_context& parent, const schema_validator<Json> *validator,
             evaluation_flags flags)
             : dynamic_scope_ { parent.dynamic_scope_ }, eval_path_{ parent.eval_path_ },
-              flags_(flags)
+              flags_(flags), record_paths_(parent.record_paths_)
         {
             if (validator->id() || dynamic_scope_.empty())
             {
@@ -109,30 +117,46 @@ namespace jsonschema {
         }
 
         eval_context(const eval_context& parent, const std::string& name)
-            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.eval_path() / name),
-              flags_(parent.flags_)
+            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.child_location(parent.eval_path_, name)),
+              flags_(parent.flags_), record_paths_(parent.record_paths_)
               
         {
         }
 
         eval_context(const eval_context& parent, const std::string& name,
             evaluation_flags flags)
-            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.eval_path() / name),
-              flags_(flags)
+            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.child_location(parent.eval_path_, name)),
+              flags_(flags), record_paths_(parent.record_paths_)
         {
         }
 
         eval_context(const eval_context& parent, std::size_t index)
-            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.eval_path() / index),
-              flags_(parent.flags_)
+            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.child_location(parent.eval_path_, index)),
+              flags_(parent.flags_), record_paths_(parent.record_paths_)
         {
         }
 
         eval_context(const eval_context& parent, std::size_t index,
             evaluation_flags flags)
-            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.eval_path() / index),
-              flags_(flags)
+            : dynamic_scope_{parent.dynamic_scope_}, eval_path_(parent.child_location(parent.eval_path_, index)),
+              flags_(flags), record_paths_(parent.record_paths_)
+        {
+        }
+
+        // Returns location / name, or an empty pointer if paths are not recorded
+        jsonpointer::json_pointer child_location(const jsonpointer::json_pointer& location, const std::string& name) const
+        {
+            return record_paths_ ? location / name : jsonpointer::json_pointer{};
+        }
+
+        jsonpointer::json_pointer child_location(const jsonpointer::json_pointer& location, std::size_t index) const
+        {
+            return record_paths_ ? location / index : jsonpointer::json_pointer{};
+        }
+
+        bool record_paths() const
         {
+            return record_paths_;
         }
 
         const std::vector<const schema_validator<Json>*>& dynamic_scope() const
@@ -16,14 +16,11 @@
 #include <system_error>
 
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/utility/regex.hpp>
 #include <jsoncons/utility/uri.hpp>
 #include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
 #include <jsoncons_ext/jsonschema/common/validator.hpp>
 
-#if defined(JSONCONS_HAS_STD_REGEX)
-#include <regex>
-#endif
-
 namespace jsoncons {
 namespace jsonschema {
 
@@ -1186,23 +1183,19 @@ namespace jsonschema {
                      const std::string& value,
                      error_reporter& reporter) 
     {
-#if defined(JSONCONS_HAS_STD_REGEX)
-        try 
-        {
-            std::regex re(value, std::regex::ECMAScript);
-        } 
-        catch (const std::exception& e) 
+        std::error_code ec;
+        regex_pattern::compile(value, regex_options::none, ec);
+        if (ec && ec != regex_errc::unsupported) // unsupported means valid but beyond the built-in engine
         {
             walk_result result = reporter.error(message_factory.make_validation_message(
                 eval_path, 
                 instance_location, 
-                "'" + value + "' is not a valid ECMAScript regular expression. " + e.what()));
+                "'" + value + "' is not a valid ECMAScript regular expression. " + ec.message()));
             if (result == walk_result::abort)
             {
                 return result;
             }
         }
-#endif
         return walk_result::advance;
     } 
 
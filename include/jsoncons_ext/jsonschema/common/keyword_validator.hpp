@@ -8,9 +8,11 @@
 #ifndef JSONCONS_EXT_JSONSCHEMA_COMMON_KEYWORD_VALIDATOR_HPP
 #define JSONCONS_EXT_JSONSCHEMA_COMMON_KEYWORD_VALIDATOR_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <system_error>
@@ -25,17 +27,15 @@
 #include <jsoncons/semantic_tag.hpp>
 #include <jsoncons/utility/byte_string.hpp>
 #include <jsoncons/utility/unicode_traits.hpp>
+#include <jsoncons/utility/regex.hpp>
 #include <jsoncons/utility/uri.hpp>
 
 #include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
 #include <jsoncons_ext/jsonschema/common/format.hpp>
+#include <jsoncons_ext/jsonschema/common/thread_pool.hpp>
 #include <jsoncons_ext/jsonschema/common/uri_wrapper.hpp>
 #include <jsoncons_ext/jsonschema/common/validator.hpp>
 
-#if defined(JSONCONS_HAS_STD_REGEX)
-#include <regex>
-#endif
-
 namespace jsoncons {
 namespace jsonschema {
     
@@ -148,6 +148,59 @@ namespace jsonschema {
         }
     };
 
+    // The errors, results and patch of validating a slice of the items or members of an instance
+    template <typename Json>
+    struct partial_evaluation
+    {
+        collecting_error_listener reporter;
+        evaluation_results results;
+        Json patch{json_array_arg};
+
+        walk_result merge_into(evaluation_results& all_results, error_reporter& all_reporter, Json& all_patch)
+        {
+            for (const auto& msg : reporter.errors)
+            {
+                walk_result result = all_reporter.error(msg);
+                if (result == walk_result::abort)
+                {
+                    return result;
+                }
+            }
+            all_results.merge(results);
+            for (auto& op : patch.array_range())
+            {
+                all_patch.push_back(std::move(op));
+            }
+            return walk_result::advance;
+        }
+    };
+
+    // Calls validate_slice(first, last, partial) for slices of [0,count) on the pool, and merges 
+    // the partial evaluations in slice order, so that messages are reported as if validated sequentially
+    template <typename Json,typename SliceValidator>
+    walk_result validate_slices(thread_pool& pool, std::size_t count,
+        evaluation_results& results, 
+        error_reporter& reporter,
+        Json& patch,
+        SliceValidator validate_slice)
+    {
+        std::size_t slice_count = (std::min)(count, pool.thread_count()*4);
+        std::vector<partial_evaluation<Json>> slices(slice_count);
+        pool.run(slice_count, [&](std::size_t i)
+        {
+            validate_slice(count*i/slice_count, count*(i+1)/slice_count, slices[i]);
+        });
+        for (auto& slice : slices)
+        {
+            walk_result result = slice.merge_into(results, reporter, patch);
+            if (result == walk_result::abort)
+            {
+                return result;
+            }
+        }
+        return walk_result::advance;
+    }
+
     template <typename Json>
     class ref_validator : public keyword_validator<Json>, public virtual ref<Json>
     {
@@ -616,7 +669,6 @@ namespace jsonschema {
 
     // pattern 
 
-#if defined(JSONCONS_HAS_STD_REGEX)
     template <typename Json>
     class pattern_validator : public keyword_validator<Json>
     {
@@ -624,13 +676,13 @@ namespace jsonschema {
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::string pattern_string_;
-        std::regex regex_;
+        regex_pattern regex_;
 
     public:
         pattern_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
-            const std::string& pattern_string, const std::regex& regex)
+            const std::string& pattern_string, regex_pattern&& regex)
             : keyword_validator<Json>("pattern", schema, schema_location, custom_message), 
-              pattern_string_(pattern_string), regex_(regex)
+              pattern_string_(pattern_string), regex_(std::move(regex))
         {
         }
 
@@ -649,11 +701,11 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            auto s = instance.template as<std::string>();
-            if (!std::regex_search(s, regex_))
+            auto sv = instance.template as<jsoncons::string_view>();
+            if (!regex_.search(sv))
             {
                 std::string message("String '");
-                message.append(s);
+                message.append(sv.data(), sv.size());
                 message.append("' does not match pattern '");
                 message.append(pattern_string_);
                 message.append("'.");
@@ -675,37 +727,6 @@ namespace jsonschema {
             return reporter(this->keyword_name(), this->schema(), this->schema_location(), instance, instance_location);
         }
     };
-#else
-    template <typename Json>
-    class pattern_validator : public keyword_validator<Json>
-    {
-        using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
-        using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
-
-    public:
-        pattern_validator(const Json& schema, const uri& schema_location, const std::string& custom_message)
-            : keyword_validator<Json>("pattern", schema, schema_location, custom_message)
-        {
-        }
-
-    private:
-
-        walk_result do_validate(const Json&, 
-            const jsonpointer::json_pointer&,
-            evaluation_results& /*results*/, 
-            error_reporter&,
-            Json& /*patch*/) const final
-        {
-            return walk_result::advance;
-        }
-
-        walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
-            const jsonpointer::json_pointer& instance_location, const walk_reporter_type& reporter) const final
-        {
-            return reporter(this->keyword_name(), this->schema(), this->schema_location(), instance, instance_location);
-        }
-    };
-#endif
 
     // maxLength
 
@@ -831,25 +852,16 @@ namespace jsonschema {
         {
         }
 
-    private:
-
-        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+        walk_result validate_size(const eval_context<Json>& context, std::size_t size, 
             const jsonpointer::json_pointer& instance_location,
-            evaluation_results& /*results*/, 
-            error_reporter& reporter,
-            Json& /*patch*/) const final
+            error_reporter& reporter) const
         {
-            if (!instance.is_array())
-            {
-                return walk_result::advance;
-            }
-
             eval_context<Json> this_context(context, this->keyword_name());
 
-            if (instance.size() > max_items_)
+            if (size > max_items_)
             {
                 std::string message("Maximum number of items is " + std::to_string(max_items_));
-                message.append(" but found " + std::to_string(instance.size()));
+                message.append(" but found " + std::to_string(size));
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
                     instance_location, 
@@ -862,6 +874,22 @@ namespace jsonschema {
             return walk_result::advance;
         }
 
+    private:
+
+        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+            const jsonpointer::json_pointer& instance_location,
+            evaluation_results& /*results*/, 
+            error_reporter& reporter,
+            Json& /*patch*/) const final
+        {
+            if (!instance.is_array())
+            {
+                return walk_result::advance;
+            }
+
+            return validate_size(context, instance.size(), instance_location, reporter);
+        }
+
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
             const jsonpointer::json_pointer& instance_location, const walk_reporter_type& reporter) const final
         {
@@ -885,25 +913,16 @@ namespace jsonschema {
         {
         }
 
-    private:
-
-        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+        walk_result validate_size(const eval_context<Json>& context, std::size_t size, 
             const jsonpointer::json_pointer& instance_location,
-            evaluation_results& /*results*/, 
-            error_reporter& reporter,
-            Json& /*patch*/) const final
+            error_reporter& reporter) const
         {
-            if (!instance.is_array())
-            {
-                return walk_result::advance;
-            }
-
             eval_context<Json> this_context(context, this->keyword_name());
 
-            if (instance.size() < min_items_)
+            if (size < min_items_)
             {
                 std::string message("Minimum number of items is " + std::to_string(min_items_));
-                message.append(" but found " + std::to_string(instance.size()));
+                message.append(" but found " + std::to_string(size));
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
                     instance_location, 
@@ -916,6 +935,22 @@ namespace jsonschema {
             return walk_result::advance;
         }
 
+    private:
+
+        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+            const jsonpointer::json_pointer& instance_location,
+            evaluation_results& /*results*/, 
+            error_reporter& reporter,
+            Json& /*patch*/) const final
+        {
+            if (!instance.is_array())
+            {
+                return walk_result::advance;
+            }
+
+            return validate_size(context, instance.size(), instance_location, reporter);
+        }
+
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
             const jsonpointer::json_pointer& instance_location, const walk_reporter_type& reporter) const final
         {
@@ -933,13 +968,22 @@ namespace jsonschema {
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         schema_validator_ptr_type schema_val_;
+        std::shared_ptr<thread_pool> thread_pool_;
+        std::size_t parallel_threshold_;
     public:
         items_validator(const std::string& keyword_name, const Json& schema, const uri& schema_location, 
             const std::string& custom_message, 
-            schema_validator_ptr_type&& schema_val)
+            schema_validator_ptr_type&& schema_val,
+            std::shared_ptr<thread_pool> pool = nullptr, std::size_t parallel_threshold = 0)
             : keyword_validator<Json>(keyword_name, schema, schema_location, custom_message), 
-              schema_val_(std::move(schema_val))
+              schema_val_(std::move(schema_val)), thread_pool_(std::move(pool)), 
+              parallel_threshold_(parallel_threshold)
+        {
+        }
+
+        const schema_validator<Json>* item_schema() const
         {
+            return schema_val_.get();
         }
 
     private:
@@ -961,7 +1005,7 @@ namespace jsonschema {
             {
                 if (schema_val_->always_fails())
                 {
-                    jsonpointer::json_pointer item_location = instance_location / 0;
+                    jsonpointer::json_pointer item_location = context.child_location(instance_location, 0);
                     walk_result result = reporter.error(this->make_validation_message(
                         this_context.eval_path(),
                         item_location, 
@@ -975,41 +1019,56 @@ namespace jsonschema {
                         results.evaluated_items.insert(range{0,instance.size()});
                     }
                 }
+                else if (thread_pool_ && instance.size() >= parallel_threshold_)
+                {
+                    return validate_slices(*thread_pool_, instance.size(), results, reporter, patch,
+                        [&](std::size_t first, std::size_t last, partial_evaluation<Json>& partial)
+                        {
+                            eval_context<Json> slice_context(this_context);
+                            validate_items(slice_context, instance, instance_location, first, last, 
+                                partial.results, partial.reporter, partial.patch);
+                        });
+                }
                 else
                 {
-                    std::size_t index = 0;
-                    std::size_t start = 0;
-                    std::size_t end = 0;
-                    for (const auto& item : instance.array_range()) 
+                    return validate_items(this_context, instance, instance_location, 0, instance.size(), 
+                        results, reporter, patch);
+                }
+            }
+            return walk_result::advance;
+        }
+
+        walk_result validate_items(const eval_context<Json>& this_context, const Json& instance, 
+            const jsonpointer::json_pointer& instance_location,
+            std::size_t first, std::size_t last,
+            evaluation_results& results, 
+            error_reporter& reporter,
+            Json& patch) const
+        {
+            std::size_t start = first;
+            std::size_t end = first;
+            for (std::size_t index = first; index < last; ++index) 
+            {
+                jsonpointer::json_pointer item_location = this_context.child_location(instance_location, index);
+                std::size_t errors = reporter.error_count();
+                walk_result result = schema_val_->validate(this_context, instance.at(index), item_location, results, reporter, patch);
+                if (result == walk_result::abort)
+                {
+                    return result;
+                }
+                if (errors == reporter.error_count())
+                {
+                    if (this_context.require_evaluated_items())
                     {
-                        jsonpointer::json_pointer item_location = instance_location / index;
-                        std::size_t errors = reporter.error_count();
-                        walk_result result = schema_val_->validate(this_context, item, item_location, results, reporter, patch);
-                        if (result == walk_result::abort)
-                        {
-                            return result;
-                        }
-                        if (errors == reporter.error_count())
-                        {
-                            if (context.require_evaluated_items())
-                            {
-                                if (end == start)
-                                {
-                                    start = end = index;
-                                }
-                                ++end;
-                            }
-                        }
-                        else
+                        if (end == start)
                         {
-                            if (start < end)
-                            {
-                                results.evaluated_items.insert(range{start, end});
-                                start = end;
-                            }
+                            start = end = index;
                         }
-                        ++index;
+                        ++end;
                     }
+                }
+                else
+                {
                     if (start < end)
                     {
                         results.evaluated_items.insert(range{start, end});
@@ -1017,6 +1076,10 @@ namespace jsonschema {
                     }
                 }
             }
+            if (start < end)
+            {
+                results.evaluated_items.insert(range{start, end});
+            }
             return walk_result::advance;
         }
 
@@ -1974,6 +2037,11 @@ namespace jsonschema {
         required_validator& operator=(const required_validator&) = delete;
         required_validator& operator=(required_validator&&) = default;
 
+        const std::vector<std::string>& required_properties() const
+        {
+            return items_;
+        }
+
     private:
 
         walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
@@ -2030,25 +2098,17 @@ namespace jsonschema {
         {
         }
 
-    private:
-
-        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+        walk_result validate_size(const eval_context<Json>& context, std::size_t size, 
             const jsonpointer::json_pointer& instance_location,
-            evaluation_results& /*results*/, 
-            error_reporter& reporter,
-            Json& /*patch*/) const final
+            error_reporter& reporter) const
         {
-            if (!instance.is_object())
-            {
-                return walk_result::advance;
-            }
             
-            if (instance.size() > max_properties_)
+            if (size > max_properties_)
             {
                 eval_context<Json> this_context(context, this->keyword_name());
 
                 std::string message("Maximum number of properties is " + std::to_string(max_properties_));
-                message.append(" but found " + std::to_string(instance.size()));
+                message.append(" but found " + std::to_string(size));
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
                     instance_location, 
@@ -2061,6 +2121,22 @@ namespace jsonschema {
             return walk_result::advance;
         }
 
+    private:
+
+        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+            const jsonpointer::json_pointer& instance_location,
+            evaluation_results& /*results*/, 
+            error_reporter& reporter,
+            Json& /*patch*/) const final
+        {
+            if (!instance.is_object())
+            {
+                return walk_result::advance;
+            }
+
+            return validate_size(context, instance.size(), instance_location, reporter);
+        }
+
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
             const jsonpointer::json_pointer& instance_location, const walk_reporter_type& reporter) const final
         {
@@ -2083,24 +2159,16 @@ namespace jsonschema {
         {
         }
 
-    private:
-
-        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+        walk_result validate_size(const eval_context<Json>& context, std::size_t size, 
             const jsonpointer::json_pointer& instance_location,
-            evaluation_results& /*results*/, 
-            error_reporter& reporter,
-            Json& /*patch*/) const final
+            error_reporter& reporter) const
         {
-            if (!instance.is_object())
-            {
-                return walk_result::advance;
-            }
-            if (instance.size() < min_properties_)
+            if (size < min_properties_)
             {
                 eval_context<Json> this_context(context, this->keyword_name());
 
                 std::string message("Minimum number of properties is " + std::to_string(min_properties_));
-                message.append(" but found " + std::to_string(instance.size()));
+                message.append(" but found " + std::to_string(size));
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
                     instance_location, 
@@ -2114,6 +2182,22 @@ namespace jsonschema {
             return walk_result::advance;
         }
 
+    private:
+
+        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+            const jsonpointer::json_pointer& instance_location,
+            evaluation_results& /*results*/, 
+            error_reporter& reporter,
+            Json& /*patch*/) const final
+        {
+            if (!instance.is_object())
+            {
+                return walk_result::advance;
+            }
+
+            return validate_size(context, instance.size(), instance_location, reporter);
+        }
+
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
             const jsonpointer::json_pointer& instance_location, const walk_reporter_type& reporter) const final
         {
@@ -2555,7 +2639,11 @@ namespace jsonschema {
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
+        using key_value_type = typename Json::key_value_type;
+
         std::map<std::string, schema_validator_ptr_type> properties_;
+        std::shared_ptr<thread_pool> thread_pool_;
+        std::size_t parallel_threshold_;
     public:
         properties_validator(const properties_validator&) = delete;
         properties_validator& operator=(const properties_validator&) = delete;
@@ -2563,12 +2651,19 @@ namespace jsonschema {
         properties_validator& operator=(properties_validator&&) = default;
 
         properties_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
-            std::map<std::string, schema_validator_ptr_type>&& properties)
+            std::map<std::string, schema_validator_ptr_type>&& properties,
+            std::shared_ptr<thread_pool> pool = nullptr, std::size_t parallel_threshold = 0)
             : keyword_validator<Json>("properties", schema, std::move(schema_location), custom_message),
-              properties_(std::move(properties))
+              properties_(std::move(properties)), thread_pool_(std::move(pool)), 
+              parallel_threshold_(parallel_threshold)
         {
         }
 
+        const std::map<std::string, schema_validator_ptr_type>& properties() const
+        {
+            return properties_;
+        }
+
         walk_result validate(const eval_context<Json>& context, const Json& instance, 
             const jsonpointer::json_pointer& instance_location,
             evaluation_results& results, 
@@ -2591,29 +2686,49 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            for (const auto& prop : instance.object_range()) 
+            if (thread_pool_ && instance.size() >= parallel_threshold_)
             {
-                auto prop_it = properties_.find(prop.key());
-
-                // check if it is in "properties"
-                if (prop_it != properties_.end()) 
+                std::vector<std::pair<const key_value_type*,const schema_validator<Json>*>> members;
+                for (const auto& prop : instance.object_range()) 
                 {
-                    eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                    jsonpointer::json_pointer prop_location = instance_location / prop.key();
-
-                    std::size_t errors = reporter.error_count();
-                    walk_result result = (*prop_it).second->validate(prop_context, prop.value(), prop_location, results, reporter, patch);
-                    if (result == walk_result::abort)
+                    auto prop_it = properties_.find(prop.key());
+                    if (prop_it != properties_.end()) 
                     {
-                        return result;
+                        members.emplace_back(&prop, (*prop_it).second.get());
+                        allowed_properties.insert(prop.key());
                     }
-                    allowed_properties.insert(prop.key());
-                    if (errors == reporter.error_count())
+                }
+                walk_result result = validate_slices(*thread_pool_, members.size(), results, reporter, patch,
+                    [&](std::size_t first, std::size_t last, partial_evaluation<Json>& partial)
                     {
-                        if (context.require_evaluated_properties())
+                        eval_context<Json> slice_context(this_context);
+                        for (std::size_t i = first; i < last; ++i)
                         {
-                            results.evaluated_properties.insert(prop.key());
+                            validate_property(slice_context, *members[i].first, *members[i].second, instance_location, 
+                                partial.results, partial.reporter, partial.patch);
+                        }
+                    });
+                if (result == walk_result::abort)
+                {
+                    return result;
+                }
+            }
+            else
+            {
+                for (const auto& prop : instance.object_range()) 
+                {
+                    auto prop_it = properties_.find(prop.key());
+
+                    // check if it is in "properties"
+                    if (prop_it != properties_.end()) 
+                    {
+                        walk_result result = validate_property(this_context, prop, *(*prop_it).second, instance_location, 
+                            results, reporter, patch);
+                        if (result == walk_result::abort)
+                        {
+                            return result;
                         }
+                        allowed_properties.insert(prop.key());
                     }
                 }
             }
@@ -2631,7 +2746,7 @@ namespace jsonschema {
                     if (default_value) 
                     { 
                         // If default value is available, update patch
-                        jsonpointer::json_pointer prop_location = instance_location / prop.first;
+                        jsonpointer::json_pointer prop_location = context.child_location(instance_location, prop.first);
 
                         update_patch(patch, prop_location, std::move(*default_value));
                     }
@@ -2668,7 +2783,7 @@ namespace jsonschema {
 
                 if (prop_it != properties_.end()) 
                 {
-                    jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                    jsonpointer::json_pointer prop_location = context.child_location(instance_location, prop.key());
                     result = (*prop_it).second->walk(context, prop.value(), prop_location, reporter);
                     allowed_properties.insert(prop.key());
                     if (result == walk_result::abort)
@@ -2699,6 +2814,32 @@ namespace jsonschema {
             return walk(context, instance, instance_location, reporter, allowed_properties);
         }
 
+        walk_result validate_property(const eval_context<Json>& this_context, const key_value_type& prop, 
+            const schema_validator<Json>& prop_schema,
+            const jsonpointer::json_pointer& instance_location,
+            evaluation_results& results, 
+            error_reporter& reporter, 
+            Json& patch) const
+        {
+            eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
+            jsonpointer::json_pointer prop_location = this_context.child_location(instance_location, prop.key());
+
+            std::size_t errors = reporter.error_count();
+            walk_result result = prop_schema.validate(prop_context, prop.value(), prop_location, results, reporter, patch);
+            if (result == walk_result::abort)
+            {
+                return result;
+            }
+            if (errors == reporter.error_count())
+            {
+                if (this_context.require_evaluated_properties())
+                {
+                    results.evaluated_properties.insert(prop.key());
+                }
+            }
+            return walk_result::advance;
+        }
+
         void update_patch(Json& patch, const jsonpointer::json_pointer& instance_location, Json&& default_value) const
         {
             Json j;
@@ -2716,16 +2857,21 @@ namespace jsonschema {
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
-        std::vector<std::pair<std::regex, schema_validator_ptr_type>> pattern_properties_;
+        std::vector<std::pair<regex_pattern, schema_validator_ptr_type>> pattern_properties_;
 
     public:
         pattern_properties_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
-            std::vector<std::pair<std::regex, schema_validator_ptr_type>>&& pattern_properties)
+            std::vector<std::pair<regex_pattern, schema_validator_ptr_type>>&& pattern_properties)
             : keyword_validator<Json>("patternProperties", schema, std::move(schema_location), custom_message),
               pattern_properties_(std::move(pattern_properties))
         {
         }
 
+        const std::vector<std::pair<regex_pattern, schema_validator_ptr_type>>& pattern_properties() const
+        {
+            return pattern_properties_;
+        }
+
         walk_result validate(const eval_context<Json>& context, const Json& instance, 
             const jsonpointer::json_pointer& instance_location, 
             evaluation_results& results, 
@@ -2733,14 +2879,6 @@ namespace jsonschema {
             Json& patch,
             std::unordered_set<std::string>& allowed_properties) const 
         {
-            (void)context;
-            (void)instance;
-            (void)instance_location;
-            (void)results;
-            (void)reporter;
-            (void)patch;
-            (void)allowed_properties;
-#if defined(JSONCONS_HAS_STD_REGEX)
             if (!instance.is_object())
             {
                 return walk_result::advance;
@@ -2749,12 +2887,12 @@ namespace jsonschema {
             for (const auto& prop : instance.object_range()) 
             {
                 eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                jsonpointer::json_pointer prop_location = context.child_location(instance_location, prop.key());
 
                 // check all matching "patternProperties"
                 for (auto& schema_pp : pattern_properties_)
                 {
-                    if (std::regex_search(prop.key(), schema_pp.first)) 
+                    if (schema_pp.first.search(prop.key())) 
                     {
                         allowed_properties.insert(prop.key());
                         std::size_t errors = reporter.error_count();
@@ -2773,7 +2911,6 @@ namespace jsonschema {
                     }
                 }
             }
-#endif
             return walk_result::advance;
         }
 
@@ -2790,18 +2927,16 @@ namespace jsonschema {
             {
                 return result;
             }
-            (void)context;
-#if defined(JSONCONS_HAS_STD_REGEX)
             eval_context<Json> this_context(context, this->keyword_name());
             for (const auto& prop : instance.object_range()) 
             {
                 eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                jsonpointer::json_pointer prop_location = context.child_location(instance_location, prop.key());
 
                 // check all matching "patternProperties"
                 for (auto& schema_pp : pattern_properties_)
                 {
-                    if (std::regex_search(prop.key(), schema_pp.first)) 
+                    if (schema_pp.first.search(prop.key())) 
                     {
                         allowed_properties.insert(prop.key());
                         result = schema_pp.second->walk(prop_context, prop.value() , prop_location, reporter);
@@ -2812,7 +2947,6 @@ namespace jsonschema {
                     }
                 }
             }
-#endif
             return walk_result::advance;
         }
 
@@ -2843,9 +2977,13 @@ namespace jsonschema {
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
+        using key_value_type = typename Json::key_value_type;
+
         std::unique_ptr<properties_validator<Json>> properties_; 
         std::unique_ptr<pattern_properties_validator<Json>> pattern_properties_;
         schema_validator_ptr_type additional_properties_;
+        std::shared_ptr<thread_pool> thread_pool_;
+        std::size_t parallel_threshold_;
 
     public:
         additional_properties_validator(const Json& schema, 
@@ -2853,16 +2991,82 @@ namespace jsonschema {
             const std::string& custom_message,
             std::unique_ptr<properties_validator<Json>>&& properties,
             std::unique_ptr<pattern_properties_validator<Json>>&& pattern_properties,
-            schema_validator_ptr_type&& additional_properties
+            schema_validator_ptr_type&& additional_properties,
+            std::shared_ptr<thread_pool> pool = nullptr, std::size_t parallel_threshold = 0
         )
             : keyword_validator<Json>("additionalProperties", schema, std::move(schema_location),
                 custom_message), 
               properties_(std::move(properties)),
               pattern_properties_(std::move(pattern_properties)),
-              additional_properties_(std::move(additional_properties))
+              additional_properties_(std::move(additional_properties)),
+              thread_pool_(std::move(pool)), 
+              parallel_threshold_(parallel_threshold)
         {
         }
 
+        const properties_validator<Json>* properties() const
+        {
+            return properties_.get();
+        }
+
+        const pattern_properties_validator<Json>* pattern_properties() const
+        {
+            return pattern_properties_.get();
+        }
+
+        const schema_validator<Json>* additional_properties() const
+        {
+            return additional_properties_.get();
+        }
+
+        walk_result report_not_allowed(const eval_context<Json>& this_context, const std::string& key, 
+            const jsonpointer::json_pointer& instance_location,
+            error_reporter& reporter) const
+        {
+            eval_context<Json> prop_context{this_context, key, evaluation_flags{}};
+            jsonpointer::json_pointer prop_location = instance_location / key;
+            return reporter.error(this->make_validation_message(
+                prop_context.eval_path(),
+                prop_location, 
+                "Additional property '" + key + "' not allowed by schema."));
+        }
+
+        walk_result validate_additional_property(const eval_context<Json>& this_context, const std::string& key, 
+            const Json& value,
+            const jsonpointer::json_pointer& instance_location,
+            evaluation_results& results, 
+            error_reporter& reporter, 
+            Json& patch) const
+        {
+            eval_context<Json> prop_context{this_context, key, evaluation_flags{}};
+            jsonpointer::json_pointer prop_location = this_context.child_location(instance_location, key);
+
+            // finally, check "additionalProperties" 
+            collecting_error_listener local_reporter;
+
+            walk_result result = additional_properties_->validate(prop_context, value, prop_location, results, local_reporter, patch);
+            if (result == walk_result::abort)
+            {
+                return result;
+            }
+            if (!local_reporter.errors.empty())
+            {
+                result = reporter.error(this->make_validation_message(
+                    this_context.eval_path(),
+                    instance_location, 
+                    "Additional property '" + key + "' found but was invalid."));
+                if (result == walk_result::abort)
+                {
+                    return result;
+                }
+            }
+            else if (this_context.require_evaluated_properties())
+            {
+                results.evaluated_properties.insert(key);
+            }
+            return walk_result::advance;
+        }
+
     private:
 
         walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
@@ -2903,16 +3107,11 @@ namespace jsonschema {
                 {
                     for (const auto& prop : instance.object_range()) 
                     {
-                        eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                        jsonpointer::json_pointer prop_location = instance_location / prop.key();
                         // check if it is in "allowed properties"
                         auto prop_it = allowed_properties.find(prop.key());
                         if (prop_it == allowed_properties.end()) 
                         {
-                            walk_result result = reporter.error(this->make_validation_message(
-                                prop_context.eval_path(),
-                                prop_location, 
-                                "Additional property '" + prop.key() + "' not allowed by schema."));
+                            walk_result result = report_not_allowed(this_context, prop.key(), instance_location, reporter);
                             if (result == walk_result::abort)
                             {
                                 return result;
@@ -2931,6 +3130,27 @@ namespace jsonschema {
                         }
                     }
                 }
+                else if (thread_pool_ && instance.size() >= parallel_threshold_)
+                {
+                    std::vector<const key_value_type*> members;
+                    for (const auto& prop : instance.object_range()) 
+                    {
+                        if (allowed_properties.find(prop.key()) == allowed_properties.end()) 
+                        {
+                            members.push_back(&prop);
+                        }
+                    }
+                    return validate_slices(*thread_pool_, members.size(), results, reporter, patch,
+                        [&](std::size_t first, std::size_t last, partial_evaluation<Json>& partial)
+                        {
+                            eval_context<Json> slice_context(this_context);
+                            for (std::size_t i = first; i < last; ++i)
+                            {
+                                validate_additional_property(slice_context, members[i]->key(), members[i]->value(), instance_location, 
+                                    partial.results, partial.reporter, partial.patch);
+                            }
+                        });
+                }
                 else
                 {
                     for (const auto& prop : instance.object_range()) 
@@ -2939,36 +3159,12 @@ namespace jsonschema {
                         auto prop_it = allowed_properties.find(prop.key());
                         if (prop_it == allowed_properties.end()) 
                         {
-                            eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                            jsonpointer::json_pointer prop_location = instance_location / prop.key();
-
-                            // finally, check "additionalProperties" 
-                            //std::cout << "additional_properties_validator a_prop_or_pattern_matched " << a_prop_or_pattern_matched << ", " << bool(additional_properties_);
-                            
-                            //std::cout << " !!!additionalProperties!!!";
-                            collecting_error_listener local_reporter;
-
-                            walk_result result = additional_properties_->validate(prop_context, prop.value() , prop_location, results, local_reporter, patch);
+                            walk_result result = validate_additional_property(this_context, prop.key(), prop.value(), instance_location, 
+                                results, reporter, patch);
                             if (result == walk_result::abort)
                             {
                                 return result;
                             }
-                            if (!local_reporter.errors.empty())
-                            {
-                                result = reporter.error(this->make_validation_message(
-                                    this_context.eval_path(),
-                                    instance_location, 
-                                    "Additional property '" + prop.key() + "' found but was invalid."));
-                                if (result == walk_result::abort)
-                                {
-                                    return result;
-                                }
-                            }
-                            else if (context.require_evaluated_properties())
-                            {
-                                results.evaluated_properties.insert(prop.key());
-                            }
-                            
                         }
                         //std::cout << "\n";
                     }
@@ -3074,7 +3270,7 @@ namespace jsonschema {
                 if (prop != instance.object_range().end()) 
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
+                    jsonpointer::json_pointer prop_location = context.child_location(instance_location, dep.first);
                     walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
@@ -3159,7 +3355,7 @@ namespace jsonschema {
                 if (prop != instance.object_range().end()) 
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
+                    jsonpointer::json_pointer prop_location = context.child_location(instance_location, dep.first);
                     walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
@@ -3238,7 +3434,7 @@ namespace jsonschema {
             {
                 if (schema_val_->always_fails())
                 {
-                    jsonpointer::json_pointer item_location = instance_location / 0;
+                    jsonpointer::json_pointer item_location = context.child_location(instance_location, 0);
                     return reporter.error(this->make_validation_message(
                         this_context.eval_path(),
                         instance_location, 
@@ -3252,7 +3448,7 @@ namespace jsonschema {
                 {
                     for (const auto& prop : instance.object_range()) 
                     {
-                        jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                        jsonpointer::json_pointer prop_location = context.child_location(instance_location, prop.key());
 
                         walk_result result = schema_val_->validate(this_context, prop.key() , instance_location, results, reporter, patch);
                         if (result == walk_result::abort)
@@ -3339,7 +3535,7 @@ namespace jsonschema {
                 if (prop != instance.object_range().end()) 
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
+                    jsonpointer::json_pointer prop_location = context.child_location(instance_location, dep.first);
                     walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
@@ -3354,7 +3550,7 @@ namespace jsonschema {
                 if (prop != instance.object_range().end()) 
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
+                    jsonpointer::json_pointer prop_location = context.child_location(instance_location, dep.first);
                     walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
@@ -3514,7 +3710,7 @@ namespace jsonschema {
             for (const auto& item : instance.array_range()) 
             {
                 std::size_t errors = local_reporter.errors.size();
-                walk_result result = schema_validator_->validate(this_context, item, instance_location / index, results, local_reporter, patch);
+                walk_result result = schema_validator_->validate(this_context, item, context.child_location(instance_location, index), results, local_reporter, patch);
                 if (result == walk_result::abort)
                 {
                     return result;
@@ -3663,7 +3859,7 @@ namespace jsonschema {
                 eval_context<Json> items_context(context, this->keyword_name());
                 if (items_val_->always_fails())
                 {
-                    jsonpointer::json_pointer item_location = instance_location / data_index;
+                    jsonpointer::json_pointer item_location = context.child_location(instance_location, data_index);
                     walk_result result = reporter.error(this->make_validation_message(
                         items_context.eval_path(), 
                         item_location,
@@ -3683,7 +3879,7 @@ namespace jsonschema {
                     std::size_t end = 0;
                     for (; data_index < instance.size(); ++data_index)
                     {
-                        jsonpointer::json_pointer item_location = instance_location / data_index;
+                        jsonpointer::json_pointer item_location = context.child_location(instance_location, data_index);
                         std::size_t errors = reporter.error_count();
                         walk_result result = items_val_->validate(items_context, instance[data_index], item_location, results, reporter, patch);
                         if (result == walk_result::abort)
@@ -3739,7 +3935,7 @@ namespace jsonschema {
                 eval_context<Json> items_context(context, this->keyword_name());
                 for (; data_index < instance.size(); ++data_index)
                 {
-                    jsonpointer::json_pointer item_location = instance_location / data_index;
+                    jsonpointer::json_pointer item_location = context.child_location(instance_location, data_index);
                     result = items_val_->walk(items_context, instance[data_index], item_location, reporter);
                     if (result == walk_result::abort)
                     {
@@ -3795,7 +3991,7 @@ namespace jsonschema {
             {
                 auto& val = prefix_item_validators_[schema_index];
                 eval_context<Json> item_context{prefix_items_context, schema_index, evaluation_flags{}};
-                jsonpointer::json_pointer item_location = instance_location / data_index;
+                jsonpointer::json_pointer item_location = context.child_location(instance_location, data_index);
                 std::size_t errors = reporter.error_count();
                 walk_result result = val->validate(item_context, instance[data_index], item_location, results, reporter, patch);
                 if (result == walk_result::abort)
@@ -3931,7 +4127,7 @@ namespace jsonschema {
                         if (prop_it == results.evaluated_properties.end()) 
                         {
                             eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                            jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                            jsonpointer::json_pointer prop_location = context.child_location(instance_location, prop.key());
 
                             walk_result result = reporter.error(this->make_validation_message(
                                 prop_context.eval_path(), 
@@ -4041,7 +4237,7 @@ namespace jsonschema {
                         if (!results.evaluated_items.contains(index)) 
                         {
                             eval_context<Json> item_context{this_context, index, evaluation_flags{}};
-                            jsonpointer::json_pointer item_location = instance_location / index;
+                            jsonpointer::json_pointer item_location = context.child_location(instance_location, index);
                             //std::cout << "Not in evaluated properties: " << item.key() << "\n";
                             walk_result result = reporter.error(this->make_validation_message(
                                 item_context.eval_path(), 
@@ -4073,7 +4269,7 @@ namespace jsonschema {
                         if (!results.evaluated_items.contains(index))
                         {
                             eval_context<Json> item_context{this_context, index, evaluation_flags{}};
-                            jsonpointer::json_pointer item_location = instance_location / index;
+                            jsonpointer::json_pointer item_location = context.child_location(instance_location, index);
                             //std::cout << "Not in evaluated properties: " << item.key() << "\n";
                             const std::size_t error_count = reporter.error_count();
                             walk_result result = schema_val_->validate(item_context, item, item_location, results, reporter, patch);
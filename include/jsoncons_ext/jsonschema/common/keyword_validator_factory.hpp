@@ -11,10 +11,12 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <system_error>
 #include <unordered_map>
 #include <utility>
 
 #include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/utility/regex.hpp>
 
 #include <jsoncons_ext/jsonschema/common/compilation_context.hpp>
 #include <jsoncons_ext/jsonschema/common/schema_validator.hpp>
@@ -71,11 +73,10 @@ namespace jsonschema {
             }
 
             return jsoncons::make_unique<properties_validator<Json>>(parent, std::move(schema_location),
-                context.get_custom_message(keyword), std::move(properties));
+                context.get_custom_message(keyword), std::move(properties),
+                factory_->get_thread_pool(), factory_->parallel_threshold());
         }
 
-#if defined(JSONCONS_HAS_STD_REGEX)
-                
         std::unique_ptr<pattern_properties_validator<Json>> make_pattern_properties_validator( const compilation_context<Json>& context, 
             const Json& sch, const Json& parent, anchor_uri_map_type& anchor_dict)
         {
@@ -83,14 +84,14 @@ namespace jsonschema {
             uri schema_location = context.get_base_uri();
             std::string custom_message = context.get_custom_message(keyword);
 
-            std::vector<std::pair<std::regex, schema_validator_ptr_type>> pattern_properties;
+            std::vector<std::pair<regex_pattern, schema_validator_ptr_type>> pattern_properties;
             
             for (const auto& prop : sch.object_range())
             {
                 std::string sub_keys[] = {keyword};
                 pattern_properties.emplace_back(
                     std::make_pair(
-                        std::regex(prop.key(), std::regex::ECMAScript),
+                        compile_pattern(schema_location, prop.key()),
                         factory_->make_cross_draft_schema_validator(context, prop.value(), sub_keys, anchor_dict)));
                 
             }
@@ -99,7 +100,6 @@ namespace jsonschema {
                 custom_message,
                 std::move(pattern_properties));
         }
-#endif       
 
         std::unique_ptr<max_length_validator<Json>> make_max_length_validator(const compilation_context<Json>& context, 
             const Json& sch, const Json& parent)
@@ -447,9 +447,9 @@ namespace jsonschema {
         {
             uri schema_location = context.make_schema_location("pattern");
             auto pattern_string = sch.template as<std::string>();
-            auto regex = std::regex(pattern_string, std::regex::ECMAScript);
+            auto regex = compile_pattern(schema_location, pattern_string);
             return jsoncons::make_unique<pattern_validator<Json>>(parent, schema_location, context.get_custom_message("pattern"), 
-                pattern_string, regex);
+                pattern_string, std::move(regex));
         }
 
         std::unique_ptr<max_items_validator<Json>> make_max_items_validator(const compilation_context<Json>& context, 
@@ -764,7 +764,8 @@ namespace jsonschema {
 
             return jsoncons::make_unique<items_validator<Json>>(keyword_name, parent, schema_location,
                 context.get_custom_message(keyword_name), 
-                factory_->make_cross_draft_schema_validator(context, sch, sub_keys, anchor_dict));
+                factory_->make_cross_draft_schema_validator(context, sch, sub_keys, anchor_dict),
+                factory_->get_thread_pool(), factory_->parallel_threshold());
         }
 
         std::unique_ptr<unevaluated_properties_validator<Json>> make_unevaluated_properties_validator(
@@ -808,7 +809,8 @@ namespace jsonschema {
             return jsoncons::make_unique<additional_properties_validator<Json>>(parent, additional_properties->schema_location(),
                 context.get_custom_message(keyword),
                 std::move(properties), std::move(pattern_properties),
-                std::move(additional_properties));
+                std::move(additional_properties),
+                factory_->get_thread_pool(), factory_->parallel_threshold());
         }
 
         // Since 202012
@@ -847,6 +849,17 @@ namespace jsonschema {
                 std::move(prefix_item_validators), std::move(items_val));
         }
 
+    private:
+        static regex_pattern compile_pattern(const uri& schema_location, const std::string& pattern)
+        {
+            std::error_code ec;
+            auto regex = regex_pattern::compile(pattern, regex_options::none, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                JSONCONS_THROW(schema_error(schema_location.string() + ": " + "Invalid regular expression '" + pattern + "': " + ec.message()));
+            }
+            return regex;
+        }
     };
 
 } // namespace jsonschema
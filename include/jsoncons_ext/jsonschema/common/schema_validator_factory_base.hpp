@@ -18,6 +18,7 @@
 
 #include <jsoncons_ext/jsonschema/common/compilation_context.hpp>
 #include <jsoncons_ext/jsonschema/common/schema_validator.hpp>
+#include <jsoncons_ext/jsonschema/common/thread_pool.hpp>
 #include <jsoncons_ext/jsonschema/evaluation_options.hpp>
 
 namespace jsoncons {
@@ -47,6 +48,7 @@ namespace jsonschema {
         schema_store_type* schema_store_ptr_;
         std::vector<resolve_uri_type<Json>> resolve_funcs_;
         std::unordered_map<std::string,bool> vocabulary_;
+        std::shared_ptr<thread_pool> thread_pool_;
 
         schema_validator_ptr_type root_;       
         
@@ -109,6 +111,22 @@ namespace jsonschema {
         {
             return options_;
         }
+
+        // Returns the pool shared by validators that split large instances, or null if
+        // options().thread_count() is 1
+        std::shared_ptr<thread_pool> get_thread_pool()
+        {
+            if (!thread_pool_ && options_.thread_count() != 1)
+            {
+                thread_pool_ = thread_pool::shared(options_.thread_count());
+            }
+            return thread_pool_;
+        }
+
+        std::size_t parallel_threshold() const
+        {
+            return options_.parallel_threshold();
+        }
         
         schema_validator_ptr_type make_boolean_schema(const compilation_context<Json>& context, const Json& sch)
         {
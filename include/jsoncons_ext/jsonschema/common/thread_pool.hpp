@@ -0,0 +1,172 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_JSONSCHEMA_COMMON_THREAD_POOL_HPP
+#define JSONCONS_EXT_JSONSCHEMA_COMMON_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+
+namespace jsoncons {
+namespace jsonschema {
+
+    // A fixed set of worker threads shared by the validators of a compiled schema.
+    // A thread that waits for its tasks runs queued tasks meanwhile, so tasks may
+    // themselves run tasks without exhausting the workers.
+    class thread_pool
+    {
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<std::function<void()>> tasks_;
+        std::vector<std::thread> workers_;
+        std::size_t thread_count_;
+        bool stop_{false};
+    public:
+        // thread_count includes the calling thread, 0 means std::thread::hardware_concurrency()
+        explicit thread_pool(std::size_t thread_count)
+            : thread_count_(thread_count != 0 ? thread_count : (std::max)(std::thread::hardware_concurrency(), 1u))
+        {
+            workers_.reserve(thread_count_ - 1);
+            for (std::size_t i = 1; i < thread_count_; ++i)
+            {
+                workers_.emplace_back([this]() {work();});
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            for (auto& t : workers_)
+            {
+                t.join();
+            }
+        }
+
+        // Returns the pool with thread_count threads that is shared by all schemas
+        // compiled with that thread count, creating it if no schema holds it.
+        static std::shared_ptr<thread_pool> shared(std::size_t thread_count)
+        {
+            static std::mutex pools_mutex;
+            static std::map<std::size_t, std::weak_ptr<thread_pool>> pools;
+
+            std::lock_guard<std::mutex> lock(pools_mutex);
+            auto& entry = pools[thread_count];
+            std::shared_ptr<thread_pool> pool = entry.lock();
+            if (!pool)
+            {
+                pool = std::make_shared<thread_pool>(thread_count);
+                entry = pool;
+            }
+            return pool;
+        }
+
+        std::size_t thread_count() const
+        {
+            return thread_count_;
+        }
+
+        // Calls f(0), ..., f(count-1) and returns when all have completed. If any call
+        // throws, the first exception is rethrown.
+        template <typename F>
+        void run(std::size_t count, F f)
+        {
+            std::size_t remaining = count;
+            std::exception_ptr exception;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    tasks_.emplace_back([this,&f,&remaining,&exception,i]()
+                    {
+                        std::exception_ptr e;
+                        JSONCONS_TRY
+                        {
+                            f(i);
+                        }
+                        JSONCONS_CATCH(...)
+                        {
+                            e = std::current_exception();
+                        }
+                        std::lock_guard<std::mutex> guard(mutex_);
+                        if (e && !exception)
+                        {
+                            exception = e;
+                        }
+                        if (--remaining == 0)
+                        {
+                            cv_.notify_all();
+                        }
+                    });
+                }
+            }
+            cv_.notify_all();
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (remaining > 0)
+            {
+                if (!tasks_.empty())
+                {
+                    auto task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                    lock.unlock();
+                    task();
+                    lock.lock();
+                }
+                else
+                {
+                    cv_.wait(lock);
+                }
+            }
+            lock.unlock();
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+
+    private:
+        void work()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            for (;;)
+            {
+                cv_.wait(lock, [this]() {return stop_ || !tasks_.empty();});
+                if (tasks_.empty())
+                {
+                    return; // stopped
+                }
+                auto task = std::move(tasks_.front());
+                tasks_.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+    };
+
+} // namespace jsonschema
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_JSONSCHEMA_COMMON_THREAD_POOL_HPP
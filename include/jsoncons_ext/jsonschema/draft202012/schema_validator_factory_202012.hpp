@@ -23,10 +23,6 @@
 #include <jsoncons_ext/jsonschema/draft202012/schema_draft202012.hpp>
 #include <jsoncons_ext/jsonschema/json_schema.hpp>
 
-#if defined(JSONCONS_HAS_STD_REGEX)
-#include <regex>
-#endif
-
 namespace jsoncons {
 namespace jsonschema {
 namespace draft202012 {
@@ -140,10 +136,8 @@ namespace draft202012 {
             validation_factory_map_.emplace("contentMediaType", 
                 [&](const compilation_context<Json>& context, const Json& sch, const Json& parent, anchor_uri_map_type&){return factory_.make_content_media_type_validator(context, sch, parent);});
 */                
-#if defined(JSONCONS_HAS_STD_REGEX)
             validation_factory_map_.emplace("pattern", 
                 [&](const compilation_context<Json>& context, const Json& sch, const Json& parent, anchor_uri_map_type&){return factory_.make_pattern_validator(context, sch, parent);});
-#endif
             validation_factory_map_.emplace("maxItems", 
                 [&](const compilation_context<Json>& context, const Json& sch, const Json& parent, anchor_uri_map_type&){return factory_.make_max_items_validator(context, sch, parent);});
             validation_factory_map_.emplace("minItems", 
@@ -363,13 +357,11 @@ namespace draft202012 {
                 }
                 std::unique_ptr<pattern_properties_validator<Json>> pattern_properties;
 
-        #if defined(JSONCONS_HAS_STD_REGEX)
                 it = sch.find("patternProperties");
                 if (it != sch.object_range().end())
                 {
                     pattern_properties = factory_.make_pattern_properties_validator(context, (*it).value(), sch, local_anchor_dict);
                 }
-        #endif
 
                 it = sch.find("additionalProperties");
                 if (it != sch.object_range().end()) 
@@ -383,12 +375,10 @@ namespace draft202012 {
                     {
                         validators.emplace_back(std::move(properties));
                     }
-    #if defined(JSONCONS_HAS_STD_REGEX)
                     if (pattern_properties)
                     {
                         validators.emplace_back(std::move(pattern_properties));
                     }
-    #endif
                 }
 
                 it = sch.find("prefixItems");
@@ -23,10 +23,6 @@
 #include <jsoncons_ext/jsonschema/draft4/schema_draft4.hpp>
 #include <jsoncons_ext/jsonschema/json_schema.hpp>
 
-#if defined(JSONCONS_HAS_STD_REGEX)
-#include <regex>
-#endif
-
 namespace jsoncons {
 namespace jsonschema {
 namespace draft4 {
@@ -76,10 +72,8 @@ namespace draft4 {
                 keyword_factory_map_.emplace("format", 
                     [&](const compilation_context<Json>& context, const Json& sch, const Json& parent, anchor_uri_map_type&){return factory_.make_format_validator(context, sch, parent);});
             }
-#if defined(JSONCONS_HAS_STD_REGEX)
             keyword_factory_map_.emplace("pattern", 
                 [&](const compilation_context<Json>& context, const Json& sch, const Json& parent, anchor_uri_map_type&){return factory_.make_pattern_validator(context, sch, parent);});
-#endif
             keyword_factory_map_.emplace("maxItems", 
                 [&](const compilation_context<Json>& context, const Json& sch, const Json& parent, anchor_uri_map_type&){return factory_.make_max_items_validator(context, sch, parent);});
             keyword_factory_map_.emplace("minItems", 
@@ -234,13 +228,11 @@ namespace draft4 {
             }
             std::unique_ptr<pattern_properties_validator<Json>> pattern_properties;
 
-    #if defined(JSONCONS_HAS_STD_REGEX)
             it = sch.find("patternProperties");
             if (it != sch.object_range().end())
             {
                 pattern_properties = factory_.make_pattern_properties_validator(context, (*it).value(), sch, anchor_dict);
             }
-    #endif
 
             it = sch.find("additionalProperties");
             if (it != sch.object_range().end()) 
@@ -254,12 +246,10 @@ namespace draft4 {
                 {
                     validators.emplace_back(std::move(properties));
                 }
-#if defined(JSONCONS_HAS_STD_REGEX)
                 if (pattern_properties)
                 {
                     validators.emplace_back(std::move(pattern_properties));
                 }
-#endif
             }
 
             it = sch.find("items");
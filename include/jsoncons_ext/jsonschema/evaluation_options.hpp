@@ -7,6 +7,7 @@
 #ifndef JSONCONS_EXT_JSONSCHEMA_EVALUATION_OPTIONS_HPP
 #define JSONCONS_EXT_JSONSCHEMA_EVALUATION_OPTIONS_HPP
 
+#include <cstddef>
 #include <string>
 
 namespace jsoncons {
@@ -48,6 +49,8 @@ namespace jsonschema {
         bool compatibility_mode_{false};
         std::string default_base_uri_;
         bool enable_custom_error_message_{false};
+        std::size_t thread_count_{1};
+        std::size_t parallel_threshold_{1024};
     public:
         evaluation_options()
             : default_version_{schema_version::draft202012()}, 
@@ -109,13 +112,35 @@ namespace jsonschema {
             return *this;
         }
 
+        std::size_t thread_count() const
+        {
+            return thread_count_;
+        }
+        evaluation_options& thread_count(std::size_t value) 
+        {
+            thread_count_ = value;
+            return *this;
+        }
+
+        std::size_t parallel_threshold() const
+        {
+            return parallel_threshold_;
+        }
+        evaluation_options& parallel_threshold(std::size_t value) 
+        {
+            parallel_threshold_ = value;
+            return *this;
+        }
+
         friend bool operator==(const evaluation_options& lhs, const evaluation_options& rhs) 
         {
             return lhs.default_version_ == rhs.default_version_
                 && lhs.require_format_validation_ == rhs.require_format_validation_
                 && lhs.compatibility_mode_ == rhs.compatibility_mode_
                 && lhs.default_base_uri_ == rhs.default_base_uri_
-                && lhs.enable_custom_error_message_ == rhs.enable_custom_error_message_;
+                && lhs.enable_custom_error_message_ == rhs.enable_custom_error_message_
+                && lhs.thread_count_ == rhs.thread_count_
+                && lhs.parallel_threshold_ == rhs.parallel_threshold_;
         }
     };
 
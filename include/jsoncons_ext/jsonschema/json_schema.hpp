@@ -11,6 +11,7 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/staj_cursor.hpp>
 
 #include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
 #include <jsoncons_ext/jsonschema/common/schema_validator.hpp>
@@ -103,6 +104,9 @@ namespace jsonschema {
        
     template <typename Json>
     class json_validator;
+
+    template <typename Json>
+    class stream_validator;
     
     template <typename Json>
     class json_schema
@@ -113,7 +117,10 @@ namespace jsonschema {
         document_schema_validator_type root_;
         
         friend class json_validator<Json>;
+        friend class stream_validator<Json>;
     public:
+        using char_type = typename Json::char_type;
+
         json_schema(document_schema_validator_type&& root)
             : root_(std::move(root))
         {
@@ -139,14 +146,21 @@ namespace jsonschema {
             return patch;
         }
 
-        // Validate input JSON against a JSON Schema 
+        // The $id of the root schema, if any
+        const jsoncons::optional<jsoncons::uri>& id() const
+        {
+            return root_->id();
+        }
+
+        // Validate input JSON against a JSON Schema, stopping at the first error. 
+        // Evaluation and instance paths are not built, since no message is returned.
         bool is_valid(const Json& instance) const
         {
             fail_early_reporter reporter;
             jsonpointer::json_pointer instance_location{};
             Json patch(json_array_arg);
 
-            eval_context<Json> context;
+            eval_context<Json> context(false);
             evaluation_results results;
             root_->validate(context, instance, instance_location, results, reporter, patch);
             return reporter.error_count() == 0;
@@ -208,6 +222,23 @@ namespace jsonschema {
             visitor.flush();
         }
         
+        // Validate the current value of a cursor against a JSON Schema as its events are read,
+        // buffering only the subtrees that need a whole value
+        template <typename MsgReporter>
+        typename std::enable_if<ext_traits::is_unary_function_object_exact<MsgReporter,walk_result,validation_message>::value,void>::type
+        validate(basic_staj_cursor<char_type>& cursor, const MsgReporter& reporter) const
+        {
+            stream_validator<Json> validator(*this, reporter);
+            cursor.read_to(validator);
+        }
+
+        bool is_valid(basic_staj_cursor<char_type>& cursor) const
+        {
+            stream_validator<Json> validator(*this, [](const validation_message&) -> walk_result {return walk_result::abort;});
+            cursor.read_to(validator);
+            return validator.error_count() == 0;
+        }
+
         template <typename WalkReporter>
         void walk(const Json& instance, const WalkReporter& reporter) const
         {
@@ -0,0 +1,165 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_JSONSCHEMA_JSON_SCHEMA_REGISTRY_HPP
+#define JSONCONS_EXT_JSONSCHEMA_JSON_SCHEMA_REGISTRY_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <jsoncons/utility/uri.hpp>
+
+#include <jsoncons_ext/jsonschema/evaluation_options.hpp>
+#include <jsoncons_ext/jsonschema/json_schema.hpp>
+#include <jsoncons_ext/jsonschema/json_schema_factory.hpp>
+
+namespace jsoncons {
+namespace jsonschema {
+
+    // Compiled schemas keyed by $id and retrieval URI, shared by all threads.
+    // A schema is compiled once, the first time it is added or looked up, and a
+    // registered schema document also resolves references to it from the schemas
+    // compiled later.
+    template <typename Json>
+    class json_schema_registry
+    {
+    public:
+        using resolver_type = std::function<Json(const jsoncons::uri&)>;
+        using schema_ptr_type = std::shared_ptr<const json_schema<Json>>;
+    private:
+        resolver_type resolver_;
+        evaluation_options options_;
+        mutable std::mutex mutex_;
+        std::unordered_map<std::string,Json> documents_;
+        std::unordered_map<std::string,schema_ptr_type> schemas_;
+    public:
+        explicit json_schema_registry(evaluation_options options = evaluation_options{})
+            : options_(std::move(options))
+        {
+        }
+
+        // resolver is called for URIs that are not registered, and may be called
+        // concurrently if the registry is shared by several threads
+        explicit json_schema_registry(const resolver_type& resolver,
+            evaluation_options options = evaluation_options{})
+            : resolver_(resolver), options_(std::move(options))
+        {
+        }
+
+        json_schema_registry(const json_schema_registry&) = delete;
+        json_schema_registry& operator=(const json_schema_registry&) = delete;
+
+        // Compiles sch and registers it under its $id, if any, and retrieval_uri,
+        // if not empty. If a schema is already registered under that key, it is kept.
+        // Throws schema_error if sch cannot be compiled.
+        schema_ptr_type add(const Json& sch, const std::string& retrieval_uri = std::string{})
+        {
+            schema_ptr_type schema = compile(sch, retrieval_uri);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            schema_ptr_type result = schema;
+            if (schema->id())
+            {
+                result = insert(*schema->id(), sch, schema);
+            }
+            if (!retrieval_uri.empty())
+            {
+                result = insert(jsoncons::uri{retrieval_uri}, sch, result);
+            }
+            return result;
+        }
+
+        // Returns the schema registered under uri. If there is none, the schema document
+        // is obtained from the resolver, compiled and registered. Returns a null pointer
+        // if the resolver does not know uri either.
+        schema_ptr_type get(const std::string& uri)
+        {
+            std::string key = to_key(jsoncons::uri{uri});
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto it = schemas_.find(key);
+                if (it != schemas_.end())
+                {
+                    return it->second;
+                }
+            }
+            if (!resolver_)
+            {
+                return schema_ptr_type{};
+            }
+            Json sch = resolver_(jsoncons::uri{key});
+            if (sch.is_null())
+            {
+                return schema_ptr_type{};
+            }
+            return add(sch, key);
+        }
+
+        bool contains(const std::string& uri) const
+        {
+            std::string key = to_key(jsoncons::uri{uri});
+            std::lock_guard<std::mutex> lock(mutex_);
+            return schemas_.find(key) != schemas_.end();
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return schemas_.size();
+        }
+
+        // Removes all schemas, schemas already returned remain valid
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            schemas_.clear();
+            documents_.clear();
+        }
+
+    private:
+        static std::string to_key(const jsoncons::uri& u)
+        {
+            return u.base().string();
+        }
+
+        schema_ptr_type insert(const jsoncons::uri& u, const Json& sch, const schema_ptr_type& schema)
+        {
+            std::string key = to_key(u);
+            documents_.emplace(key, sch);
+            return schemas_.emplace(std::move(key), schema).first->second;
+        }
+
+        schema_ptr_type compile(const Json& sch, const std::string& retrieval_uri) const
+        {
+            auto resolver = [this](const jsoncons::uri& u) -> Json
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    auto it = documents_.find(to_key(u));
+                    if (it != documents_.end())
+                    {
+                        return it->second;
+                    }
+                }
+                return resolver_ ? resolver_(u) : Json::null();
+            };
+            if (retrieval_uri.empty())
+            {
+                return std::make_shared<json_schema<Json>>(make_json_schema(sch, resolver, options_));
+            }
+            return std::make_shared<json_schema<Json>>(make_json_schema(sch, retrieval_uri, resolver, options_));
+        }
+    };
+
+} // namespace jsonschema
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_JSONSCHEMA_JSON_SCHEMA_REGISTRY_HPP
@@ -8,5 +8,7 @@
 #define JSONCONS_EXT_JSONSCHEMA_JSONSCHEMA_HPP
 
 #include <jsoncons_ext/jsonschema/json_schema_factory.hpp>
+#include <jsoncons_ext/jsonschema/json_schema_registry.hpp>
+#include <jsoncons_ext/jsonschema/stream_validator.hpp>
 
 #endif // JSONCONS_EXT_JSONSCHEMA_JSONSCHEMA_HPP
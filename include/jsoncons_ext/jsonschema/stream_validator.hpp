@@ -0,0 +1,798 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_JSONSCHEMA_STREAM_VALIDATOR_HPP
+#define JSONCONS_EXT_JSONSCHEMA_STREAM_VALIDATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/ser_util.hpp>
+#include <jsoncons/staj_cursor.hpp>
+
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <jsoncons_ext/jsonschema/common/keyword_validator.hpp>
+#include <jsoncons_ext/jsonschema/common/schema_validator.hpp>
+#include <jsoncons_ext/jsonschema/json_schema.hpp>
+
+namespace jsoncons {
+namespace jsonschema {
+
+    // Validates the events of a JSON document against a compiled schema as they arrive.
+    // Containers are validated keyword by keyword from their events, and a container that
+    // is subject to a keyword that needs the whole value, e.g. uniqueItems or anyOf, is decoded
+    // into a Json and validated when its last event arrives.
+    template <typename Json>
+    class stream_validator : public basic_json_visitor<typename Json::char_type>
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_view_type = typename basic_json_visitor<char_type>::string_view_type;
+        using string_type = std::basic_string<char_type>;
+    private:
+        static constexpr std::size_t max_ref_depth = 64;
+
+        template <typename Validator>
+        struct bound_validator
+        {
+            const Validator* validator;
+            eval_context<Json> context;
+
+            bound_validator(const Validator* validator, const eval_context<Json>& context)
+                : validator(validator), context(context)
+            {
+            }
+        };
+
+        using schema_entry = bound_validator<schema_validator<Json>>;
+        using keyword_entry = bound_validator<keyword_validator<Json>>;
+
+        // minItems, maxItems, minProperties or maxProperties
+        struct size_entry
+        {
+            using check_type = walk_result(*)(const keyword_validator<Json>*, const eval_context<Json>&, std::size_t,
+                const jsonpointer::json_pointer&, error_reporter&);
+
+            const keyword_validator<Json>* validator;
+            eval_context<Json> context;
+            check_type check;
+
+            size_entry(const keyword_validator<Json>* validator, const eval_context<Json>& context, check_type check)
+                : validator(validator), context(context), check(check)
+            {
+            }
+        };
+
+        template <typename Validator>
+        static walk_result check_size(const keyword_validator<Json>* validator, const eval_context<Json>& context, 
+            std::size_t size, const jsonpointer::json_pointer& instance_location, error_reporter& reporter)
+        {
+            return static_cast<const Validator*>(validator)->validate_size(context, size, instance_location, reporter);
+        }
+
+        struct additional_entry
+        {
+            const additional_properties_validator<Json>* validator;
+            eval_context<Json> context;
+            bool reported;
+
+            additional_entry(const additional_properties_validator<Json>* validator, const eval_context<Json>& context)
+                : validator(validator), context(context), reported(false)
+            {
+            }
+        };
+
+        // The keywords that apply to an object or array that is validated from its events
+        struct frame
+        {
+            bool is_object;
+            jsonpointer::json_pointer location;
+            std::size_t count;
+            std::vector<schema_entry> false_schemas;
+            std::vector<keyword_entry> types;
+            std::vector<schema_entry> items;
+            std::vector<keyword_entry> no_items;
+            std::vector<bound_validator<properties_validator<Json>>> properties;
+            std::vector<bound_validator<pattern_properties_validator<Json>>> pattern_properties;
+            std::vector<additional_entry> additional_properties;
+            std::vector<size_entry> sizes;
+            std::vector<bound_validator<required_validator<Json>>> required;
+            Json required_found;
+
+            frame(bool is_object, jsonpointer::json_pointer&& location)
+                : is_object(is_object), location(std::move(location)), count(0)
+            {
+            }
+        };
+
+        // The schemas that apply to the next value
+        struct value_entries
+        {
+            std::vector<schema_entry> schemas;
+            std::vector<bound_validator<additional_properties_validator<Json>>> additional_properties;
+            string_type key;
+            jsonpointer::json_pointer location;
+            jsonpointer::json_pointer parent_location;
+
+            void clear()
+            {
+                schemas.clear();
+                additional_properties.clear();
+            }
+
+            void swap(value_entries& other)
+            {
+                schemas.swap(other.schemas);
+                additional_properties.swap(other.additional_properties);
+                key.swap(other.key);
+                std::swap(location, other.location);
+                std::swap(parent_location, other.parent_location);
+            }
+        };
+
+        class stream_error_reporter : public error_reporter
+        {
+            error_reporter* reporter_;
+            bool aborted_;
+        public:
+            stream_error_reporter(error_reporter& reporter)
+                : reporter_(std::addressof(reporter)), aborted_(false)
+            {
+            }
+
+            bool aborted() const
+            {
+                return aborted_;
+            }
+
+            void reset()
+            {
+                aborted_ = false;
+            }
+        private:
+            walk_result do_error(const validation_message& msg) final
+            {
+                if (aborted_)
+                {
+                    return walk_result::abort;
+                }
+                walk_result result = reporter_->error(msg);
+                if (result == walk_result::abort)
+                {
+                    aborted_ = true;
+                }
+                return result;
+            }
+        };
+
+        const schema_validator<Json>* root_;
+        error_reporter_adaptor adaptor_;
+        stream_error_reporter reporter_;
+        std::vector<frame> frames_;
+        value_entries next_;
+        value_entries buffered_;
+        std::size_t buffer_depth_;
+        json_decoder<Json> decoder_;
+        string_type key_;
+        bool done_;
+    public:
+        template <typename MsgReporter>
+        stream_validator(const json_schema<Json>& schema, const MsgReporter& reporter)
+            : root_(schema.root_.get()), adaptor_(reporter), reporter_(adaptor_),
+              buffer_depth_(0), done_(false)
+        {
+        }
+
+        stream_validator(const stream_validator&) = delete;
+        stream_validator& operator=(const stream_validator&) = delete;
+
+        // The number of validation messages reported so far
+        std::size_t error_count() const
+        {
+            return reporter_.error_count();
+        }
+
+        // True if the reporter returned walk_result::abort
+        bool aborted() const
+        {
+            return reporter_.aborted();
+        }
+
+        // True once the events of a complete value have been validated
+        bool done() const
+        {
+            return done_;
+        }
+
+        // Prepares to validate another document, error_count() keeps counting
+        void reset()
+        {
+            reporter_.reset();
+            frames_.clear();
+            buffer_depth_ = 0;
+            decoder_.reset();
+            done_ = false;
+        }
+
+    private:
+        bool skip() const
+        {
+            return done_ || reporter_.aborted();
+        }
+
+        void validate_value(const Json& value, const value_entries& entries)
+        {
+            evaluation_results results;
+            Json patch{json_array_arg};
+            for (const auto& entry : entries.schemas)
+            {
+                if (entry.validator->validate(entry.context, value, entries.location, results, reporter_, patch) == walk_result::abort)
+                {
+                    return;
+                }
+            }
+            for (const auto& entry : entries.additional_properties)
+            {
+                if (entry.validator->validate_additional_property(entry.context, entries.key, value, entries.parent_location,
+                    results, reporter_, patch) == walk_result::abort)
+                {
+                    return;
+                }
+            }
+        }
+
+        // Determines the schemas that apply to the next value from the enclosing container
+        void begin_value()
+        {
+            if (frames_.empty())
+            {
+                next_.clear();
+                next_.schemas.emplace_back(root_, eval_context<Json>{});
+                next_.location = jsonpointer::json_pointer{};
+                return;
+            }
+            frame& parent = frames_.back();
+            next_.parent_location = parent.location;
+            if (parent.is_object)
+            {
+                // the schemas were determined when the key was read
+                next_.location = parent.location / key_;
+                return;
+            }
+
+            std::size_t index = parent.count++;
+            next_.clear();
+            next_.location = parent.location / index;
+            for (const auto& entry : parent.items)
+            {
+                next_.schemas.push_back(entry);
+            }
+            if (index == 0)
+            {
+                Json one_item(json_array_arg);
+                one_item.push_back(Json::null());
+                evaluation_results results;
+                Json patch{json_array_arg};
+                for (const auto& entry : parent.no_items)
+                {
+                    entry.validator->validate(entry.context, one_item, parent.location, results, reporter_, patch);
+                }
+            }
+        }
+
+        void end_value()
+        {
+            if (frames_.empty())
+            {
+                done_ = true;
+            }
+        }
+
+        // Adds the keywords of schema that apply to a container to f. Returns false if
+        // a keyword needs the whole container.
+        bool add_keywords(const schema_validator<Json>* schema, const eval_context<Json>& context, frame& f, std::size_t depth) const
+        {
+            if (depth > max_ref_depth)
+            {
+                return false;
+            }
+            if (schema->always_succeeds())
+            {
+                return true;
+            }
+            auto document = dynamic_cast<const document_schema_validator<Json>*>(schema);
+            if (document != nullptr)
+            {
+                return add_keywords(document->root_validator(), context, f, depth + 1);
+            }
+            if (dynamic_cast<const boolean_schema_validator<Json>*>(schema) != nullptr)
+            {
+                f.false_schemas.emplace_back(schema, context);
+                return true;
+            }
+            auto object_schema = dynamic_cast<const object_schema_validator<Json>*>(schema);
+            if (object_schema == nullptr || object_schema->unevaluated_properties_val_ || object_schema->unevaluated_items_val_)
+            {
+                return false;
+            }
+
+            eval_context<Json> this_context{context, object_schema, context.eval_flags()};
+            for (const auto& val : object_schema->validators_)
+            {
+                const keyword_validator<Json>* keyword = val.get();
+                if (dynamic_cast<const type_validator<Json>*>(keyword) != nullptr)
+                {
+                    f.types.emplace_back(keyword, this_context);
+                }
+                else if (auto ref = dynamic_cast<const ref_validator<Json>*>(keyword))
+                {
+                    if (ref->referred_schema() == nullptr ||
+                        !add_keywords(ref->referred_schema(), eval_context<Json>(this_context, ref->keyword_name()), f, depth + 1))
+                    {
+                        return false;
+                    }
+                }
+                else if (is_scalar_keyword(keyword))
+                {
+                    continue;
+                }
+                else if (f.is_object)
+                {
+                    if (auto properties = dynamic_cast<const properties_validator<Json>*>(keyword))
+                    {
+                        f.properties.emplace_back(properties, this_context);
+                    }
+                    else if (auto pattern_properties = dynamic_cast<const pattern_properties_validator<Json>*>(keyword))
+                    {
+                        f.pattern_properties.emplace_back(pattern_properties, this_context);
+                    }
+                    else if (auto additional_properties = dynamic_cast<const additional_properties_validator<Json>*>(keyword))
+                    {
+                        f.additional_properties.emplace_back(additional_properties, this_context);
+                    }
+                    else if (auto required = dynamic_cast<const required_validator<Json>*>(keyword))
+                    {
+                        f.required.emplace_back(required, this_context);
+                    }
+                    else if (dynamic_cast<const max_properties_validator<Json>*>(keyword) != nullptr)
+                    {
+                        f.sizes.emplace_back(keyword, this_context, &check_size<max_properties_validator<Json>>);
+                    }
+                    else if (dynamic_cast<const min_properties_validator<Json>*>(keyword) != nullptr)
+                    {
+                        f.sizes.emplace_back(keyword, this_context, &check_size<min_properties_validator<Json>>);
+                    }
+                    else if (!is_array_keyword(keyword))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    if (auto items = dynamic_cast<const items_validator<Json>*>(keyword))
+                    {
+                        const schema_validator<Json>* item_schema = items->item_schema();
+                        if (item_schema != nullptr && item_schema->always_fails())
+                        {
+                            f.no_items.emplace_back(keyword, this_context);
+                        }
+                        else if (item_schema != nullptr && !item_schema->always_succeeds())
+                        {
+                            f.items.emplace_back(item_schema, eval_context<Json>(this_context, keyword->keyword_name()));
+                        }
+                    }
+                    else if (dynamic_cast<const max_items_validator<Json>*>(keyword) != nullptr)
+                    {
+                        f.sizes.emplace_back(keyword, this_context, &check_size<max_items_validator<Json>>);
+                    }
+                    else if (dynamic_cast<const min_items_validator<Json>*>(keyword) != nullptr)
+                    {
+                        f.sizes.emplace_back(keyword, this_context, &check_size<min_items_validator<Json>>);
+                    }
+                    else if (!is_object_keyword(keyword))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Keywords that only constrain strings and numbers
+        static bool is_scalar_keyword(const keyword_validator<Json>* keyword)
+        {
+            return dynamic_cast<const format_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const pattern_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const max_length_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const min_length_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const maximum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const exclusive_maximum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const minimum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const exclusive_minimum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const multiple_of_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const content_encoding_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const content_media_type_validator<Json>*>(keyword) != nullptr;
+        }
+
+        // Keywords that only constrain objects
+        static bool is_object_keyword(const keyword_validator<Json>* keyword)
+        {
+            return dynamic_cast<const properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const pattern_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const additional_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const required_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const max_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const min_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const dependent_required_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const dependent_schemas_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const dependencies_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const property_names_validator<Json>*>(keyword) != nullptr;
+        }
+
+        // Keywords that only constrain arrays
+        static bool is_array_keyword(const keyword_validator<Json>* keyword)
+        {
+            return dynamic_cast<const items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const prefix_items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const max_items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const min_items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const unique_items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const contains_validator<Json>*>(keyword) != nullptr;
+        }
+
+        void begin_container(bool is_object, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            begin_value();
+
+            frame f(is_object, std::move(next_.location));
+            bool streamable = next_.additional_properties.empty();
+            for (std::size_t i = 0; streamable && i < next_.schemas.size(); ++i)
+            {
+                streamable = add_keywords(next_.schemas[i].validator, next_.schemas[i].context, f, 0);
+            }
+            if (!streamable)
+            {
+                next_.location = std::move(f.location);
+                buffered_.swap(next_);
+                buffer_depth_ = 1;
+                decoder_.reset();
+                if (is_object)
+                {
+                    decoder_.begin_object(tag, context, ec);
+                }
+                else
+                {
+                    decoder_.begin_array(tag, context, ec);
+                }
+                return;
+            }
+
+            evaluation_results results;
+            Json patch{json_array_arg};
+            Json empty = is_object ? Json(json_object_arg) : Json(json_array_arg);
+            for (const auto& entry : f.false_schemas)
+            {
+                entry.validator->validate(entry.context, empty, f.location, results, reporter_, patch);
+            }
+            for (const auto& entry : f.types)
+            {
+                entry.validator->validate(entry.context, empty, f.location, results, reporter_, patch);
+            }
+            frames_.push_back(std::move(f));
+        }
+
+        void end_container()
+        {
+            frame& f = frames_.back();
+            for (const auto& entry : f.sizes)
+            {
+                entry.check(entry.validator, entry.context, f.count, f.location, reporter_);
+            }
+            evaluation_results results;
+            Json patch{json_array_arg};
+            for (const auto& entry : f.required)
+            {
+                entry.validator->validate(entry.context, f.required_found, f.location, results, reporter_, patch);
+            }
+            frames_.pop_back();
+            end_value();
+        }
+
+        void end_buffered_value()
+        {
+            Json value = decoder_.get_result();
+            validate_value(value, buffered_);
+            end_value();
+        }
+
+        // Determines the schemas that apply to the value of the member with name key_
+        void read_key()
+        {
+            frame& f = frames_.back();
+            ++f.count;
+            next_.clear();
+            next_.key = key_;
+
+            for (const auto& entry : f.properties)
+            {
+                add_property_schemas(*entry.validator, entry.context);
+            }
+            for (const auto& entry : f.pattern_properties)
+            {
+                add_pattern_property_schemas(*entry.validator, entry.context);
+            }
+            for (auto& entry : f.additional_properties)
+            {
+                bool allowed = false;
+                if (entry.validator->properties() != nullptr)
+                {
+                    allowed = add_property_schemas(*entry.validator->properties(), entry.context) || allowed;
+                }
+                if (entry.validator->pattern_properties() != nullptr)
+                {
+                    allowed = add_pattern_property_schemas(*entry.validator->pattern_properties(), entry.context) || allowed;
+                }
+                const schema_validator<Json>* additional_schema = entry.validator->additional_properties();
+                if (allowed || additional_schema == nullptr || additional_schema->always_succeeds())
+                {
+                    continue;
+                }
+                eval_context<Json> this_context(entry.context, entry.validator->keyword_name());
+                if (additional_schema->always_fails())
+                {
+                    if (!entry.reported)
+                    {
+                        entry.reported = true;
+                        entry.validator->report_not_allowed(this_context, key_, f.location, reporter_);
+                    }
+                }
+                else
+                {
+                    next_.additional_properties.emplace_back(entry.validator, this_context);
+                }
+            }
+            for (const auto& entry : f.required)
+            {
+                const auto& keys = entry.validator->required_properties();
+                if (std::find(keys.begin(), keys.end(), key_) != keys.end())
+                {
+                    f.required_found.try_emplace(key_, Json::null());
+                }
+            }
+        }
+
+        bool add_property_schemas(const properties_validator<Json>& validator, const eval_context<Json>& context)
+        {
+            const auto& properties = validator.properties();
+            auto it = properties.find(key_);
+            if (it == properties.end())
+            {
+                return false;
+            }
+            eval_context<Json> this_context(context, validator.keyword_name());
+            next_.schemas.emplace_back((*it).second.get(), eval_context<Json>{this_context, key_, evaluation_flags{}});
+            return true;
+        }
+
+        bool add_pattern_property_schemas(const pattern_properties_validator<Json>& validator, const eval_context<Json>& context)
+        {
+            bool matched = false;
+            eval_context<Json> this_context(context, validator.keyword_name());
+            for (const auto& schema_pp : validator.pattern_properties())
+            {
+                if (schema_pp.first.search(key_))
+                {
+                    next_.schemas.emplace_back(schema_pp.second.get(), eval_context<Json>{this_context, key_, evaluation_flags{}});
+                    matched = true;
+                }
+            }
+            return matched;
+        }
+
+        template <typename ScalarFactory>
+        void scalar_value(ScalarFactory make_value)
+        {
+            begin_value();
+            if (!next_.schemas.empty() || !next_.additional_properties.empty())
+            {
+                validate_value(make_value(), next_);
+            }
+            end_value();
+        }
+
+        void visit_flush() final
+        {
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                ++buffer_depth_;
+                decoder_.begin_object(tag, context, ec);
+            }
+            else if (!skip())
+            {
+                begin_container(true, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.end_object(context, ec);
+                if (--buffer_depth_ == 0 && !skip())
+                {
+                    end_buffered_value();
+                }
+            }
+            else if (!skip())
+            {
+                end_container();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                ++buffer_depth_;
+                decoder_.begin_array(tag, context, ec);
+            }
+            else if (!skip())
+            {
+                begin_container(false, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.end_array(context, ec);
+                if (--buffer_depth_ == 0 && !skip())
+                {
+                    end_buffered_value();
+                }
+            }
+            else if (!skip())
+            {
+                end_container();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.key(name, context, ec);
+            }
+            else if (!skip())
+            {
+                key_.assign(name.data(), name.size());
+                read_key();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.null_value(tag, context, ec);
+            }
+            else if (!skip())
+            {
+                scalar_value([&]() {return Json(null_type(), tag);});
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.bool_value(value, tag, context, ec);
+            }
+            else if (!skip())
+            {
+                scalar_value([&]() {return Json(value, tag);});
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag,
+            const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.string_value(value, tag, context, ec);
+            }
+            else if (!skip())
+            {
+                scalar_value([&]() {return Json(value, tag);});
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, semantic_tag tag,
+            const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.byte_string_value(value, tag, context, ec);
+            }
+            else if (!skip())
+            {
+                scalar_value([&]() {return Json(byte_string_arg, value, tag);});
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag,
+            const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.uint64_value(value, tag, context, ec);
+            }
+            else if (!skip())
+            {
+                scalar_value([&]() {return Json(value, tag);});
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag,
+            const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.int64_value(value, tag, context, ec);
+            }
+            else if (!skip())
+            {
+                scalar_value([&]() {return Json(value, tag);});
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag,
+            const ser_context& context, std::error_code& ec) final
+        {
+            if (buffer_depth_ > 0)
+            {
+                decoder_.double_value(value, tag, context, ec);
+            }
+            else if (!skip())
+            {
+                scalar_value([&]() {return Json(value, tag);});
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+    template <typename Json>
+    constexpr std::size_t stream_validator<Json>::max_ref_depth;
+
+} // namespace jsonschema
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_JSONSCHEMA_STREAM_VALIDATOR_HPP
@@ -11,6 +11,7 @@
 #include <functional>
 #include <memory> // std::allocator
 #include <system_error>
+#include <vector>
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
@@ -159,11 +160,26 @@ public:
         return parser_.done();
     }
 
+    bool is_typed_array() const
+    {
+        return cursor_visitor_.is_typed_array();
+    }
+
     const staj_event& current() const override
     {
         return cursor_visitor_.event();
     }
 
+    // If the current event begins a typed array ext value (see msgpack_options::use_typed_arrays) 
+    // whose elements are T, copies the elements into v with one bulk copy, reusing its 
+    // capacity, and returns true. Like read_to, the array is consumed, and next() moves 
+    // to the event after it. Otherwise returns false and leaves the cursor where it is.
+    template <typename T,typename Alloc>
+    bool read_typed_array(std::vector<T,Alloc>& v, std::error_code& ec)
+    {
+        return cursor_visitor_.read_typed_array(v, *this, ec);
+    }
+
     void read_to(basic_json_visitor<char_type>& visitor) override
     {
         std::error_code ec;
@@ -177,7 +193,11 @@ public:
     void read_to(basic_json_visitor<char_type>& visitor,
         std::error_code& ec) override
     {
-        if (is_begin_container(current().event_type()))
+        if (is_typed_array())
+        {
+            cursor_visitor_.dump(visitor, *this, ec);
+        }
+        else if (is_begin_container(current().event_type()))
         {
             parser_.cursor_mode(false);
             parser_.mark_level(parser_.level());
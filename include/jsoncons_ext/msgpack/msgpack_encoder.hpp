@@ -13,6 +13,7 @@
 #include <limits> // std::numeric_limits
 #include <memory>
 #include <system_error>
+#include <type_traits>
 #include <utility> // std::move
 #include <vector>
 
@@ -456,58 +457,62 @@ namespace msgpack {
             const ser_context&,
             std::error_code&) final
         {
-            const std::size_t length = b.size();
+            write_ext_header(b.size(), static_cast<uint8_t>(ext_tag));
+
+            for (auto c : b)
+            {
+                sink_.push_back(c);
+            }
+
+            end_value();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        void write_ext_header(std::size_t length, uint8_t ext_tag)
+        {
             switch (length)
             {
                 case 1:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext1_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 2:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext2_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 4:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext4_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 8:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext8_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 16:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext16_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 default:
                     if (length <= (std::numeric_limits<uint8_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext8_type);
                         sink_.push_back(static_cast<uint8_t>(length));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        sink_.push_back(ext_tag);
                     }
                     else if (length <= (std::numeric_limits<uint16_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext16_type);
                         binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        sink_.push_back(ext_tag);
                     }
                     else if (length <= (std::numeric_limits<uint32_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext32_type);
                         binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        sink_.push_back(ext_tag);
                     }
                     break;
             }
-
-            for (auto c : b)
-            {
-                sink_.push_back(c);
-            }
-
-            end_value();
-            JSONCONS_VISITOR_RETURN;
         }
 
         JSONCONS_VISITOR_RETURN_TYPE visit_double(double val, 
@@ -751,6 +756,161 @@ namespace msgpack {
             JSONCONS_VISITOR_RETURN;
         }
 
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint8_t>& data,  
+            semantic_tag tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(tag == semantic_tag::clamped ? 0x44 : 0x40, data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint16_t>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x41), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint32_t>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x42), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint64_t>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x43), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int8_t>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(0x48, data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int16_t>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x49), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int32_t>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x4a), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int64_t>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x4b), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const float>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x51), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const double>& data,  
+            semantic_tag,
+            const ser_context& context, 
+            std::error_code& ec) final
+        {
+            write_typed_array(native_endian_tag(0x52), data, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        // Tags 0x41-0x43, 0x49-0x4b and 0x51-0x52 are big endian, adding 4 gives the little endian tag
+        static uint8_t native_endian_tag(uint8_t big_endian_tag)
+        {
+            return jsoncons::endian::native == jsoncons::endian::big ? big_endian_tag : static_cast<uint8_t>(big_endian_tag + 4);
+        }
+
+        // With use_typed_arrays, writes data as an ext value whose type is the RFC 8746 typed array tag,
+        // with the elements in native byte order, otherwise as an array of individual values
+        template <typename T>
+        void write_typed_array(uint8_t ext_type, const jsoncons::span<const T>& data, 
+            const ser_context& context, std::error_code& ec)
+        {
+            if (!options_.use_typed_arrays())
+            {
+                this->begin_array(data.size(), semantic_tag::none, context, ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+                for (auto p = data.begin(); p != data.end(); ++p)
+                {
+                    write_element(*p, context, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                }
+                this->end_array(context, ec);
+                return;
+            }
+
+            write_ext_header(data.size()*sizeof(T), ext_type);
+            write_bytes(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(T), 
+                ext_traits::has_sink_append<Sink>());
+            end_value();
+        }
+
+        template <typename T>
+        typename std::enable_if<std::is_floating_point<T>::value>::type
+        write_element(T val, const ser_context& context, std::error_code& ec)
+        {
+            this->double_value(val, semantic_tag::none, context, ec);
+        }
+
+        template <typename T>
+        typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+        write_element(T val, const ser_context& context, std::error_code& ec)
+        {
+            this->int64_value(val, semantic_tag::none, context, ec);
+        }
+
+        template <typename T>
+        typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+        write_element(T val, const ser_context& context, std::error_code& ec)
+        {
+            this->uint64_value(val, semantic_tag::none, context, ec);
+        }
+
+        void write_bytes(const uint8_t* data, std::size_t length, std::true_type)
+        {
+            sink_.append(data, length);
+        }
+
+        void write_bytes(const uint8_t* data, std::size_t length, std::false_type)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                sink_.push_back(data[i]);
+            }
+        }
+
         void end_value()
         {
             if (!stack_.empty())
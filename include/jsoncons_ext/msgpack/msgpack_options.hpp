@@ -19,11 +19,12 @@ class msgpack_options_common
     friend class msgpack_options;
 
     int max_nesting_depth_;
+    bool use_typed_arrays_;
 protected:
     virtual ~msgpack_options_common() = default;
 
     msgpack_options_common()
-        : max_nesting_depth_(1024)
+        : max_nesting_depth_(1024), use_typed_arrays_(false)
     {
     }
 
@@ -36,6 +37,11 @@ public:
     {
         return max_nesting_depth_;
     }
+
+    bool use_typed_arrays() const 
+    {
+        return use_typed_arrays_;
+    }
 };
 
 class msgpack_decode_options : public virtual msgpack_options_common
@@ -60,12 +66,19 @@ class msgpack_options final : public msgpack_decode_options, public msgpack_enco
 {
 public:
     using msgpack_options_common::max_nesting_depth;
+    using msgpack_options_common::use_typed_arrays;
 
     msgpack_options& max_nesting_depth(int value)
     {
         this->max_nesting_depth_ = value;
         return *this;
     }
+
+    msgpack_options& use_typed_arrays(bool value)
+    {
+        this->use_typed_arrays_ = value;
+        return *this;
+    }
 };
 
 } // namespace msgpack
@@ -636,10 +636,13 @@ private:
                             return;
                         }
 
-                        visitor.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()), 
-                                                          static_cast<uint8_t>(ext_type), 
-                                                          *this,
-                                                          ec);
+                        if (!(options_.use_typed_arrays() && read_typed_array(visitor, ext_type, ec)))
+                        {
+                            visitor.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()), 
+                                                              static_cast<uint8_t>(ext_type), 
+                                                              *this,
+                                                              ec);
+                        }
                         more_ = !cursor_mode_;
                     }
                     break;
@@ -669,6 +672,70 @@ private:
         }
     }
 
+    // An ext value whose type is an RFC 8746 typed array tag is reported as a typed array. 
+    // Returns false if the type is not one of those tags or the payload is not a whole 
+    // number of elements.
+    bool read_typed_array(item_event_visitor& visitor, int8_t ext_type, std::error_code& ec)
+    {
+        const jsoncons::endian e = (ext_type & 0x04) == 0 ? jsoncons::endian::big : jsoncons::endian::little;
+        switch (ext_type)
+        {
+            case 0x40:
+                return read_typed_array<uint8_t>(visitor, e, semantic_tag::none, ec);
+            case 0x44:
+                return read_typed_array<uint8_t>(visitor, e, semantic_tag::clamped, ec);
+            case 0x41:
+            case 0x45:
+                return read_typed_array<uint16_t>(visitor, e, semantic_tag::none, ec);
+            case 0x42:
+            case 0x46:
+                return read_typed_array<uint32_t>(visitor, e, semantic_tag::none, ec);
+            case 0x43:
+            case 0x47:
+                return read_typed_array<uint64_t>(visitor, e, semantic_tag::none, ec);
+            case 0x48:
+                return read_typed_array<int8_t>(visitor, e, semantic_tag::none, ec);
+            case 0x49:
+            case 0x4d:
+                return read_typed_array<int16_t>(visitor, e, semantic_tag::none, ec);
+            case 0x4a:
+            case 0x4e:
+                return read_typed_array<int32_t>(visitor, e, semantic_tag::none, ec);
+            case 0x4b:
+            case 0x4f:
+                return read_typed_array<int64_t>(visitor, e, semantic_tag::none, ec);
+            case 0x51:
+            case 0x55:
+                return read_typed_array<float>(visitor, e, semantic_tag::none, ec);
+            case 0x52:
+            case 0x56:
+                return read_typed_array<double>(visitor, e, semantic_tag::none, ec);
+            default:
+                return false;
+        }
+    }
+
+    template <typename T>
+    bool read_typed_array(item_event_visitor& visitor, jsoncons::endian e, semantic_tag tag, std::error_code& ec)
+    {
+        if (bytes_buffer_.size() % sizeof(T) != 0)
+        {
+            return false;
+        }
+        T* data = reinterpret_cast<T*>(bytes_buffer_.data());
+        std::size_t size = bytes_buffer_.size()/sizeof(T);
+
+        if (sizeof(T) > 1 && e != jsoncons::endian::native)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                data[i] = binary::byte_swap<T>(data[i]);
+            }
+        }
+        visitor.typed_array(jsoncons::span<const T>(data,size), tag, *this, ec);
+        return true;
+    }
+
     void begin_array(item_event_visitor& visitor, uint8_t type, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
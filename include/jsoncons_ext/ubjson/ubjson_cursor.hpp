@@ -13,6 +13,7 @@
 #include <memory> // std::allocator
 #include <stdexcept>
 #include <system_error>
+#include <vector>
 
 #include <jsoncons/utility/byte_string.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
@@ -151,11 +152,26 @@ public:
         return parser_.done();
     }
 
+    bool is_typed_array() const
+    {
+        return cursor_visitor_.is_typed_array();
+    }
+
     const staj_event& current() const override
     {
         return cursor_visitor_.event();
     }
 
+    // If the current event begins an array optimized with a numeric type and count 
+    // whose elements are T, copies the elements into v with one bulk copy, reusing its 
+    // capacity, and returns true. Like read_to, the array is consumed, and next() moves 
+    // to the event after it. Otherwise returns false and leaves the cursor where it is.
+    template <typename T,typename Alloc>
+    bool read_typed_array(std::vector<T,Alloc>& v, std::error_code& ec)
+    {
+        return cursor_visitor_.read_typed_array(v, *this, ec);
+    }
+
     void read_to(basic_json_visitor<char_type>& visitor) override
     {
         std::error_code ec;
@@ -169,7 +185,11 @@ public:
     void read_to(basic_json_visitor<char_type>& visitor,
         std::error_code& ec) override
     {
-        if (is_begin_container(current().event_type()))
+        if (is_typed_array())
+        {
+            cursor_visitor_.dump(visitor, *this, ec);
+        }
+        else if (is_begin_container(current().event_type()))
         {
             parser_.cursor_mode(false);
             parser_.mark_level(parser_.level());
@@ -241,11 +261,18 @@ public:
 private:
     void read_next(std::error_code& ec)
     {
-        parser_.restart();
-        while (!parser_.stopped())
+        if (cursor_visitor_.in_available())
         {
-            parser_.parse(cursor_visitor_, ec);
-            if (JSONCONS_UNLIKELY(ec)) {return;}
+            cursor_visitor_.send_available(ec);
+        }
+        else
+        {
+            parser_.restart();
+            while (!parser_.stopped())
+            {
+                parser_.parse(cursor_visitor_, ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+            }
         }
     }
 
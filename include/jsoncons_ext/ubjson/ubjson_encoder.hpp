@@ -7,11 +7,13 @@
 #ifndef JSONCONS_EXT_UBJSON_UBJSON_ENCODER_HPP
 #define JSONCONS_EXT_UBJSON_UBJSON_ENCODER_HPP
 
+#include <algorithm> // std::min
 #include <cstddef>
 #include <cstdint>
 #include <limits> // std::numeric_limits
 #include <memory>
 #include <system_error>
+#include <type_traits>
 #include <utility> // std::move
 #include <vector>
 
@@ -492,6 +494,160 @@ private:
         JSONCONS_VISITOR_RETURN;
     }
 
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint8_t>& data,  
+        semantic_tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        write_typed_array(jsoncons::ubjson::ubjson_type::uint8_type, data, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int8_t>& data,  
+        semantic_tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        write_typed_array(jsoncons::ubjson::ubjson_type::int8_type, data, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int16_t>& data,  
+        semantic_tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        write_typed_array(jsoncons::ubjson::ubjson_type::int16_type, data, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int32_t>& data,  
+        semantic_tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        write_typed_array(jsoncons::ubjson::ubjson_type::int32_type, data, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int64_t>& data,  
+        semantic_tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        write_typed_array(jsoncons::ubjson::ubjson_type::int64_type, data, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const float>& data,  
+        semantic_tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        write_typed_array(jsoncons::ubjson::ubjson_type::float32_type, data, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const double>& data,  
+        semantic_tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        write_typed_array(jsoncons::ubjson::ubjson_type::float64_type, data, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    // With use_typed_arrays, writes data as an array optimized with type and count,
+    // otherwise as an array of individually typed values
+    template <typename T>
+    void write_typed_array(uint8_t type, const jsoncons::span<const T>& data, 
+        const ser_context& context, std::error_code& ec)
+    {
+        if (!options_.use_typed_arrays())
+        {
+            this->begin_array(data.size(), semantic_tag::none, context, ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+            for (auto p = data.begin(); p != data.end(); ++p)
+            {
+                write_element(*p, context, ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+            }
+            this->end_array(context, ec);
+            return;
+        }
+
+        sink_.push_back(jsoncons::ubjson::ubjson_type::start_array_marker);
+        sink_.push_back(jsoncons::ubjson::ubjson_type::type_marker);
+        sink_.push_back(type);
+        sink_.push_back(jsoncons::ubjson::ubjson_type::count_marker);
+        put_length(data.size());
+        write_big_endian(data, std::integral_constant<bool, sizeof(T) == 1 || jsoncons::endian::native == jsoncons::endian::big>());
+        end_value();
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    write_element(T val, const ser_context& context, std::error_code& ec)
+    {
+        this->double_value(val, semantic_tag::none, context, ec);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+    write_element(T val, const ser_context& context, std::error_code& ec)
+    {
+        this->int64_value(val, semantic_tag::none, context, ec);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+    write_element(T val, const ser_context& context, std::error_code& ec)
+    {
+        this->uint64_value(val, semantic_tag::none, context, ec);
+    }
+
+    // The elements are already big endian
+    template <typename T>
+    void write_big_endian(const jsoncons::span<const T>& data, std::true_type)
+    {
+        write_bytes(reinterpret_cast<const uint8_t*>(data.data()), data.size()*sizeof(T), 
+            ext_traits::has_sink_append<Sink>());
+    }
+
+    // The elements are byte swapped a chunk at a time
+    template <typename T>
+    void write_big_endian(const jsoncons::span<const T>& data, std::false_type)
+    {
+        constexpr std::size_t chunk_size = 512/sizeof(T);
+        T buffer[chunk_size];
+
+        std::size_t offset = 0;
+        while (offset < data.size())
+        {
+            const std::size_t n = (std::min)(chunk_size, data.size() - offset);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                buffer[i] = binary::byte_swap<T>(data[offset+i]);
+            }
+            write_bytes(reinterpret_cast<const uint8_t*>(buffer), n*sizeof(T), 
+                ext_traits::has_sink_append<Sink>());
+            offset += n;
+        }
+    }
+
+    void write_bytes(const uint8_t* data, std::size_t length, std::true_type)
+    {
+        sink_.append(data, length);
+    }
+
+    void write_bytes(const uint8_t* data, std::size_t length, std::false_type)
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            sink_.push_back(data[i]);
+        }
+    }
+
     void end_value()
     {
         if (!stack_.empty())
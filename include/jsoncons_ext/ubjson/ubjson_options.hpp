@@ -58,9 +58,17 @@ public:
 class ubjson_encode_options : public virtual ubjson_options_common
 {
     friend class ubjson_options;
+
+    bool use_typed_arrays_;
 public:
     ubjson_encode_options()
+        : use_typed_arrays_(false)
+    {
+    }
+
+    bool use_typed_arrays() const 
     {
+        return use_typed_arrays_;
     }
 };
 
@@ -68,6 +76,7 @@ class ubjson_options final : public ubjson_decode_options, public ubjson_encode_
 {
 public:
     using ubjson_options_common::max_nesting_depth;
+    using ubjson_encode_options::use_typed_arrays;
 
     ubjson_options& max_nesting_depth(int value)
     {
@@ -80,6 +89,12 @@ public:
         this->max_items_ = value;
         return *this;
     }
+
+    ubjson_options& use_typed_arrays(bool value)
+    {
+        this->use_typed_arrays_ = value;
+        return *this;
+    }
 };
 
 } // namespace ubjson
@@ -7,6 +7,7 @@
 #ifndef JSONCONS_EXT_UBJSON_UBJSON_PARSER_HPP
 #define JSONCONS_EXT_UBJSON_UBJSON_PARSER_HPP
 
+#include <algorithm> // std::min
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -69,6 +70,7 @@ class basic_ubjson_parser : public ser_context
     Source source_;
     ubjson_decode_options options_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
+    std::vector<uint8_t,byte_allocator_type> typed_array_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
 public:
     template <typename Sourceable>
@@ -78,6 +80,7 @@ public:
        : source_(std::forward<Sourceable>(source)), 
          options_(options),
          text_buffer_(alloc),
+         typed_array_(alloc),
          state_stack_(alloc)
     {
         state_stack_.emplace_back(parse_mode::root,0);
@@ -93,6 +96,7 @@ public:
         more_ = true;
         done_ = false;
         text_buffer_.clear();
+        typed_array_.clear();
         state_stack_.clear();
         state_stack_.emplace_back(parse_mode::root,0,uint8_t(0));
         nesting_depth_ = 0;
@@ -625,6 +629,32 @@ private:
                     more_ = false;
                     return;
                 }
+                switch (b)
+                {
+                    case jsoncons::ubjson::ubjson_type::uint8_type:
+                        read_typed_array<uint8_t>(visitor, length, ec);
+                        return;
+                    case jsoncons::ubjson::ubjson_type::int8_type:
+                        read_typed_array<int8_t>(visitor, length, ec);
+                        return;
+                    case jsoncons::ubjson::ubjson_type::int16_type:
+                        read_typed_array<int16_t>(visitor, length, ec);
+                        return;
+                    case jsoncons::ubjson::ubjson_type::int32_type:
+                        read_typed_array<int32_t>(visitor, length, ec);
+                        return;
+                    case jsoncons::ubjson::ubjson_type::int64_type:
+                        read_typed_array<int64_t>(visitor, length, ec);
+                        return;
+                    case jsoncons::ubjson::ubjson_type::float32_type:
+                        read_typed_array<float>(visitor, length, ec);
+                        return;
+                    case jsoncons::ubjson::ubjson_type::float64_type:
+                        read_typed_array<double>(visitor, length, ec);
+                        return;
+                    default:
+                        break;
+                }
                 state_stack_.emplace_back(parse_mode::strongly_typed_array,length,b);
                 visitor.begin_array(length, semantic_tag::none, *this, ec);
                 more_ = !cursor_mode_;
@@ -662,6 +692,42 @@ private:
         }
     }
 
+    // An array optimized with a fixed width numeric type and count is read a chunk 
+    // at a time, so that memory grows with the input actually present, converted to 
+    // native byte order in place, and reported as one typed array
+    template <typename T>
+    void read_typed_array(json_visitor& visitor, std::size_t length, std::error_code& ec)
+    {
+        const std::size_t chunk_size = (std::size_t(1) << 16)/sizeof(T);
+
+        typed_array_.clear();
+        std::size_t count = 0;
+        while (count < length)
+        {
+            const std::size_t n = (std::min)(chunk_size, length - count);
+            typed_array_.resize((count + n)*sizeof(T));
+            if (source_.read(typed_array_.data() + count*sizeof(T), n*sizeof(T)) != n*sizeof(T))
+            {
+                ec = ubjson_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            count += n;
+        }
+
+        T* data = reinterpret_cast<T*>(typed_array_.data());
+        if (sizeof(T) > 1 && jsoncons::endian::native != jsoncons::endian::big)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                data[i] = binary::byte_swap<T>(data[i]);
+            }
+        }
+        --nesting_depth_;
+        visitor.typed_array(jsoncons::span<const T>(data, length), semantic_tag::none, *this, ec);
+        more_ = !cursor_mode_;
+    }
+
     void end_array(json_visitor& visitor, std::error_code& ec)
     {
         --nesting_depth_;
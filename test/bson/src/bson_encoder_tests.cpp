@@ -312,3 +312,124 @@ TEMPLATE_TEST_CASE("test_bson_encoder_reset", "",
     f.encoder.flush();
     CHECK(f.bytes2() == expected_full);
 }
+
+namespace {
+
+    // Accepts bytes but cannot seek, like a pipe
+    class unseekable_buf : public std::streambuf
+    {
+    public:
+        std::string data;
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (ch != traits_type::eof())
+            {
+                data.push_back(static_cast<char>(ch));
+            }
+            return ch;
+        }
+    };
+
+    void encode_events(json_visitor& visitor)
+    {
+        visitor.begin_object();
+        visitor.key("name");
+        visitor.string_value("Sayings of the Century");
+        visitor.key("tags");
+        visitor.begin_array();
+        for (int i = 0; i < 20; ++i)
+        {
+            visitor.begin_object();
+            visitor.key("id");
+            visitor.int64_value(i);
+            visitor.key("nested");
+            visitor.begin_array();
+            visitor.double_value(i * 1.5);
+            visitor.bool_value(i % 2 == 0);
+            visitor.null_value();
+            visitor.end_array();
+            visitor.end_object();
+        }
+        visitor.end_array();
+        visitor.key("data");
+        visitor.byte_string_value(std::vector<uint8_t>{1, 2, 3, 4, 5});
+        visitor.key("large");
+        visitor.int64_value((std::numeric_limits<int64_t>::max)());
+        visitor.end_object();
+        visitor.flush();
+    }
+}
+
+TEST_CASE("bson encoder write_through")
+{
+    std::vector<uint8_t> expected;
+    {
+        bson::bson_bytes_encoder encoder(expected);
+        encode_events(encoder);
+    }
+    REQUIRE_FALSE(expected.empty());
+
+    auto options = bson::bson_options{}.write_through(true);
+
+    SECTION("bytes sink")
+    {
+        std::vector<uint8_t> data = {0xff, 0xfe}; // existing content is left alone
+        {
+            bson::bson_bytes_encoder encoder(data, options);
+            encode_events(encoder);
+        }
+        REQUIRE(data.size() == expected.size() + 2);
+        CHECK(data[0] == 0xff);
+        CHECK(data[1] == 0xfe);
+        CHECK(std::vector<uint8_t>(data.begin() + 2, data.end()) == expected);
+    }
+
+    SECTION("seekable stream, lengths patched after the bytes reach the stream")
+    {
+        std::stringstream os;
+        os << "xy";
+        {
+            bson::bson_stream_encoder encoder(binary_stream_sink(os, 8), options);
+            encode_events(encoder);
+        }
+        std::string s = os.str();
+        REQUIRE(s.size() == expected.size() + 2);
+        CHECK(s.substr(0, 2) == "xy");
+        CHECK(std::vector<uint8_t>(s.begin() + 2, s.end()) == expected);
+    }
+
+    SECTION("unseekable stream is buffered")
+    {
+        unseekable_buf buf;
+        std::ostream os(&buf);
+        {
+            bson::bson_stream_encoder encoder(os, options);
+            encode_events(encoder);
+        }
+        CHECK(std::vector<uint8_t>(buf.data.begin(), buf.data.end()) == expected);
+    }
+
+    SECTION("encode_bson")
+    {
+        ojson j = bson::decode_bson<ojson>(expected);
+        std::vector<uint8_t> data;
+        bson::encode_bson(j, data, options);
+        CHECK(data == expected);
+    }
+
+    SECTION("one document per encoder until reset")
+    {
+        std::vector<uint8_t> data;
+        bson::bson_bytes_encoder encoder(data, options);
+        encoder.begin_object();
+        encoder.end_object();
+        std::error_code ec;
+        encoder.begin_object(semantic_tag::none, ser_context(), ec);
+        CHECK(ec == bson::bson_errc::expected_bson_document);
+        encoder.reset();
+        encoder.begin_object();
+        encoder.end_object();
+        CHECK(data.size() == 10);
+    }
+}
@@ -416,6 +416,54 @@ TEST_CASE("encode stringref")
     CHECK(j2 == j);
 }
 
+TEST_CASE("encode stringref text and byte strings")
+{
+    auto options = cbor::cbor_options{}
+        .pack_strings(true);
+
+    SECTION("text and byte strings with the same bytes are distinct")
+    {
+        std::vector<uint8_t> buf;
+        cbor::cbor_bytes_encoder encoder(buf, options);
+        std::vector<uint8_t> bytes = {'a','b','c'};
+        encoder.begin_array(4);
+        encoder.string_value("abc");
+        encoder.byte_string_value(bytes);
+        encoder.string_value("abc");
+        encoder.byte_string_value(bytes);
+        encoder.end_array();
+        encoder.flush();
+
+        std::vector<uint8_t> expected = {0xd9,0x01,0x00, // tag(256)
+            0x84,
+            0x63,'a','b','c',
+            0x43,'a','b','c',
+            0xd8,0x19,0x00, // tag(25), stringref 0
+            0xd8,0x19,0x01  // tag(25), stringref 1
+        };
+        CHECK(buf == expected);
+    }
+
+    SECTION("many strings")
+    {
+        json j(json_array_arg);
+        for (int k = 0; k < 2; ++k)
+        {
+            for (int i = 0; i < 2000; ++i)
+            {
+                j.push_back("string-" + std::to_string(i));
+                j.push_back(json(byte_string_arg, std::string("bytes-") + std::to_string(i)));
+            }
+        }
+        std::vector<uint8_t> packed;
+        cbor::encode_cbor(j, packed, options);
+        std::vector<uint8_t> unpacked;
+        cbor::encode_cbor(j, unpacked);
+        CHECK(packed.size() < unpacked.size());
+        CHECK(cbor::decode_cbor<json>(packed) == j);
+    }
+}
+
 TEST_CASE("cbor encode with semantic_tags")
 {
     SECTION("string")
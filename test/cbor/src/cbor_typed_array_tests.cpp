@@ -105,6 +105,78 @@ TEST_CASE("cbor typed array cursor tests")
     }
 }
 
+TEST_CASE("cbor cursor read_typed_array tests")
+{
+    const std::vector<uint8_t> input = {
+        0x82, // Array of length 2
+            0xd8, // Tag
+                0x51, // Tag 81, float32, big endian, Typed Array
+            0x48, // Byte string value of length 8
+                0x3f,0xc0,0x00,0x00, // 1.5
+                0xc0,0x20,0x00,0x00, // -2.5
+            0x01
+    };
+
+    SECTION("matching element type")
+    {
+        cbor::cbor_bytes_cursor cursor(input);
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        std::vector<float> v = {9.0f, 9.0f, 9.0f};
+        std::error_code ec;
+        CHECK_FALSE(cursor.read_typed_array(v, ec)); // not a typed array
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        CHECK(cursor.read_typed_array(v, ec));
+        CHECK_FALSE(ec);
+        CHECK(v == std::vector<float>{1.5f, -2.5f});
+
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::uint64_value);
+        CHECK(cursor.current().get<int>() == 1);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+    }
+
+    SECTION("other element type")
+    {
+        cbor::cbor_bytes_cursor cursor(input);
+        cursor.next();
+        std::vector<double> v;
+        std::error_code ec;
+        CHECK_FALSE(cursor.read_typed_array(v, ec));
+        CHECK(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::double_value);
+        CHECK(cursor.current().get<double>() == 1.5);
+    }
+
+    SECTION("decode_cbor")
+    {
+        std::vector<float> expected;
+        for (int i = 0; i < 10000; ++i)
+        {
+            expected.push_back(static_cast<float>(i) / 4);
+        }
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(expected, data, cbor::cbor_options{}.use_typed_arrays(true));
+
+        CHECK(cbor::decode_cbor<std::vector<float>>(data) == expected);
+
+        std::string s(data.begin(), data.end());
+        std::istringstream is(s);
+        CHECK(cbor::decode_cbor<std::vector<float>>(is) == expected);
+
+        // converted element by element
+        auto u = cbor::decode_cbor<std::vector<double>>(data);
+        REQUIRE(u.size() == expected.size());
+        CHECK(u[10] == 2.5);
+
+        auto w = cbor::decode_cbor<std::vector<std::vector<float>>>(std::vector<uint8_t>{0x81, 0xd8, 0x51, 0x44, 0x3f, 0xc0, 0x00, 0x00});
+        REQUIRE(w.size() == 1);
+        CHECK(w[0] == std::vector<float>{1.5f});
+    }
+}
+
 TEST_CASE("cbor typed array tests")
 {
     SECTION("Tag 64 (uint8 Typed Array)")
@@ -822,3 +894,39 @@ TEST_CASE("cbor typed array tests")
     }
 } 
 
+
+TEST_CASE("cbor typed array encode to stream and bytes")
+{
+    std::vector<double> doubles(1000);
+    std::vector<int32_t> ints(1000);
+    for (std::size_t i = 0; i < doubles.size(); ++i)
+    {
+        doubles[i] = static_cast<double>(i) * 0.5 - 100.0;
+        ints[i] = static_cast<int32_t>(i) * -7;
+    }
+    auto options = cbor::cbor_options{}.use_typed_arrays(true);
+
+    std::vector<uint8_t> data;
+    cbor::cbor_bytes_encoder bytes_encoder(data, options);
+    bytes_encoder.begin_array(2);
+    bytes_encoder.typed_array(jsoncons::span<const double>(doubles));
+    bytes_encoder.typed_array(jsoncons::span<const int32_t>(ints));
+    bytes_encoder.end_array();
+    bytes_encoder.flush();
+
+    std::ostringstream os;
+    cbor::cbor_stream_encoder stream_encoder(os, options);
+    stream_encoder.begin_array(2);
+    stream_encoder.typed_array(jsoncons::span<const double>(doubles));
+    stream_encoder.typed_array(jsoncons::span<const int32_t>(ints));
+    stream_encoder.end_array();
+    stream_encoder.flush();
+
+    std::string s = os.str();
+    CHECK(std::vector<uint8_t>(s.begin(), s.end()) == data);
+
+    auto j = cbor::decode_cbor<json>(data);
+    REQUIRE(j.size() == 2);
+    CHECK(j[0].as<std::vector<double>>() == doubles);
+    CHECK(j[1].as<std::vector<int32_t>>() == ints);
+}
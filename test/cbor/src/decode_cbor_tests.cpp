@@ -9,6 +9,8 @@
 #include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
 #include <jsoncons/json.hpp>
 
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 #include <vector>
 #include <utility>
@@ -779,5 +781,23 @@ TEST_CASE("encode decode cbor source")
         cbor::encode_cbor(j, buffer);
         CHECK(buffer == input);
     }
+    SECTION("from file")
+    {
+        std::string path = "./decode_cbor_from_file.cbor";
+        {
+            std::ofstream os(path, std::ios::binary);
+            os.write(reinterpret_cast<const char*>(input.data()), static_cast<std::streamsize>(input.size()));
+        }
+
+        ojson j = cbor::decode_cbor<ojson>(jsoncons::file_path_arg, path);
+        std::vector<uint8_t> buffer;
+        cbor::encode_cbor(j, buffer);
+        CHECK(buffer == input);
+
+        auto result = cbor::try_decode_cbor<std::vector<ojson>>(jsoncons::file_path_arg, path);
+        std::remove(path.c_str());
+        REQUIRE(result);
+        CHECK(result->size() == 8);
+    }
 }
 
@@ -0,0 +1,136 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("monotonic_arena tests")
+{
+    SECTION("alignment")
+    {
+        monotonic_arena arena(64);
+        for (std::size_t align : {1, 2, 4, 8, 16})
+        {
+            void* p = arena.allocate(3, align);
+            CHECK(reinterpret_cast<uintptr_t>(p) % align == 0);
+        }
+    }
+    SECTION("oversized request")
+    {
+        monotonic_arena arena(64);
+        char* p = static_cast<char*>(arena.allocate(10000, 8));
+        p[0] = 'a';
+        p[9999] = 'b';
+        CHECK(arena.capacity() >= 10000);
+        arena.release();
+        CHECK(arena.capacity() == 0);
+    }
+    SECTION("initial buffer")
+    {
+        alignas(16) char buffer[256];
+        monotonic_arena arena(buffer, sizeof(buffer));
+        char* p = static_cast<char*>(arena.allocate(100, 1));
+        CHECK(p == buffer);
+        CHECK(arena.capacity() == 0);
+
+        arena.allocate(200, 1);
+        CHECK(arena.capacity() > 0);
+
+        arena.release();
+        CHECK(arena.capacity() == 0);
+        CHECK(static_cast<char*>(arena.allocate(8, 1)) == buffer);
+    }
+}
+
+#if defined(JSONCONS_HAS_STATEFUL_ALLOCATOR) && JSONCONS_HAS_STATEFUL_ALLOCATOR == 1
+
+TEST_CASE("arena_allocator tests")
+{
+    monotonic_arena arena1;
+    monotonic_arena arena2;
+
+    arena_allocator<char> alloc1(arena1);
+    arena_allocator<int> alloc2(alloc1);
+    arena_allocator<char> alloc3(arena2);
+
+    CHECK(alloc1 == arena_allocator<char>(alloc2));
+    CHECK(alloc1 != alloc3);
+
+    std::vector<int,arena_allocator<int>> v(alloc2);
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+    }
+    CHECK(v.size() == 1000);
+    CHECK(v[999] == 999);
+    CHECK(arena1.capacity() >= 1000*sizeof(int));
+    CHECK(arena2.capacity() == 0);
+}
+
+TEST_CASE("arena_json tests")
+{
+    std::string input = R"(
+{
+    "name" : "A string that is too long to be stored inline",
+    "values" : [1, 2.5, "three", null, true, {"nested" : ["x","y","z"]}],
+    "bytes" : "Zm9vYmFy"
+}
+    )";
+
+    SECTION("parse")
+    {
+        monotonic_arena arena;
+        arena_json j = arena_json::parse(combine_allocators(arena_json::allocator_type(arena)), input);
+
+        CHECK(j.at("name").as<std::string>() == "A string that is too long to be stored inline");
+        CHECK(j.at("values").size() == 6);
+        CHECK(j.at("values")[5].at("nested")[2].as<std::string>() == "z");
+        CHECK(arena.capacity() > 0);
+    }
+    SECTION("try_decode_json")
+    {
+        monotonic_arena arena;
+        auto result = try_decode_json<arena_json>(arena, input);
+        REQUIRE(result);
+        CHECK(result->at("values")[2].as<std::string>() == "three");
+        CHECK(result->get_allocator().outer_allocator() == arena_allocator<char>(arena));
+
+        json expected = json::parse(input);
+        CHECK(json::parse(result->to_string()) == expected);
+    }
+    SECTION("decode_json from stream")
+    {
+        monotonic_arena arena;
+        std::istringstream is(input);
+        arena_ojson j = decode_json<arena_ojson>(arena, is);
+        CHECK(j.object_range().begin()->value().as<std::string>() == "A string that is too long to be stored inline");
+        CHECK(j.at("values")[1].as<double>() == 2.5);
+    }
+    SECTION("decode_json error")
+    {
+        monotonic_arena arena;
+        auto result = try_decode_json<arena_json>(arena, std::string("[1,2"));
+        CHECK_FALSE(result);
+        REQUIRE_THROWS(decode_json<arena_json>(arena, std::string("{\"a\"")));
+    }
+    SECTION("modify")
+    {
+        monotonic_arena arena;
+        arena_json j = decode_json<arena_json>(arena, input);
+        j["values"].emplace_back("A string that is too long to be stored inline");
+        j.erase("name");
+        j["values"][0] = arena_json(json_array_arg, semantic_tag::none, arena_allocator<char>(arena));
+        CHECK(j.size() == 2);
+        CHECK(j.at("values").size() == 7);
+        CHECK(j.at("values")[0].is_array());
+    }
+}
+
+#endif
@@ -58,7 +58,7 @@ static void check_dtoa(double x, const std::vector<std::string>& expected)
     check_safe_dtoa(x,expected);
 }
 
-TEST_CASE("test grisu3")
+TEST_CASE("test dtoa_general")
 {
     check_dtoa(1.0e100, {"1e+100"});
     check_dtoa(1.0e-100, {"1e-100"});
@@ -100,3 +100,108 @@ TEST_CASE("test grisu3")
     check_dtoa(0.000071, {"7.1e-05"}); 
 }
 
+
+TEST_CASE("test shortest round trip")
+{
+    // values for which grisu3 cannot decide the shortest representation
+    check_dtoa(5e-324, {"5e-324", "4.94065645841247e-324"});
+    check_dtoa(1.7976931348623157e308, {"1.7976931348623157e+308"});
+    check_dtoa(2.2250738585072014e-308, {"2.2250738585072014e-308"});
+    check_dtoa(9007199254740993.0, {"9007199254740992.0"});
+    check_dtoa(1e23, {"1e+23"});
+    check_dtoa(5e-324*3, {"1.5e-323", "1.48219693752374e-323"});
+
+    std::string s;
+    REQUIRE(jsoncons::utility::dtoa_general(-0.0, '.', s));
+    CHECK(s == "0.0");
+
+    s.clear();
+    REQUIRE(jsoncons::utility::dtoa_scientific(1.0e100, '.', s));
+    CHECK(s == "1e+100");
+
+    s.clear();
+    REQUIRE(jsoncons::utility::dtoa_scientific(-0.000123, '.', s));
+    CHECK(s == "-1.23e-04");
+
+    s.clear();
+    REQUIRE(jsoncons::utility::dtoa_fixed(1.5e20, '.', s));
+    CHECK(s == "150000000000000000000.0");
+}
+
+static std::string write_double_with(double val, float_chars_format format, int precision)
+{
+    std::string s;
+    jsoncons::utility::write_double f{format, precision};
+    f(val, s);
+    return s;
+}
+
+TEST_CASE("test write_double fixed precision")
+{
+    SECTION("fixed")
+    {
+        CHECK(write_double_with(3.14159, float_chars_format::fixed, 2) == "3.14");
+        CHECK(write_double_with(-3.14159, float_chars_format::fixed, 4) == "-3.1416");
+        CHECK(write_double_with(0.125, float_chars_format::fixed, 2) == "0.12"); // tie, rounds to even
+        CHECK(write_double_with(0.375, float_chars_format::fixed, 2) == "0.38");
+        CHECK(write_double_with(2.675, float_chars_format::fixed, 2) == "2.67"); // 2.67499999...
+        CHECK(write_double_with(9.996, float_chars_format::fixed, 2) == "10.00");
+        CHECK(write_double_with(0.0004, float_chars_format::fixed, 3) == "0.000");
+        CHECK(write_double_with(0.0006, float_chars_format::fixed, 3) == "0.001");
+        CHECK(write_double_with(-0.0, float_chars_format::fixed, 1) == "-0.0");
+        CHECK(write_double_with(1e22, float_chars_format::fixed, 1) == "10000000000000000000000.0");
+        CHECK(write_double_with(1e23, float_chars_format::fixed, 1) == "99999999999999991611392.0");
+    }
+    SECTION("scientific")
+    {
+        CHECK(write_double_with(3.14159, float_chars_format::scientific, 2) == "3.14e+00");
+        CHECK(write_double_with(1234563, float_chars_format::scientific, 3) == "1.235e+06");
+        CHECK(write_double_with(2.5, float_chars_format::scientific, 0 + 1) == "2.5e+00");
+        CHECK(write_double_with(9.96e-5, float_chars_format::scientific, 1) == "1.0e-04");
+        CHECK(write_double_with(0.0, float_chars_format::scientific, 3) == "0.000e+00");
+        CHECK(write_double_with(5e-324, float_chars_format::scientific, 5) == "4.94066e-324");
+        CHECK(write_double_with(1.7976931348623157e308, float_chars_format::scientific, 20) == "1.79769313486231570815e+308");
+    }
+    SECTION("general")
+    {
+        CHECK(write_double_with(1234563, float_chars_format::general, 6) == "1.23456e+06");
+        CHECK(write_double_with(0.0000001234563, float_chars_format::general, 6) == "1.23456e-07");
+        CHECK(write_double_with(100, float_chars_format::general, 3) == "100.0");
+        CHECK(write_double_with(1000, float_chars_format::general, 3) == "1e+03");
+        CHECK(write_double_with(0.0001, float_chars_format::general, 3) == "0.0001");
+        CHECK(write_double_with(0.00001, float_chars_format::general, 3) == "1e-05");
+        CHECK(write_double_with(1.1, float_chars_format::general, 17) == "1.1000000000000001");
+        CHECK(write_double_with(0.5, float_chars_format::general, 1) == "0.5");
+        CHECK(write_double_with(2.5, float_chars_format::general, 1) == "2.0");
+        CHECK(write_double_with(3.5, float_chars_format::general, 1) == "4.0");
+        CHECK(write_double_with(-0.0, float_chars_format::general, 6) == "-0.0");
+    }
+    SECTION("agrees with snprintf")
+    {
+        const double values[] = {0.1, 1.0/3.0, 2.0/3.0, 123456.789, 1e-10, 6.02214076e23, 1e15 + 0.3, 4.35, 0.045, 1e-320};
+        for (double val : values)
+        {
+            for (int precision = 1; precision <= 25; ++precision)
+            {
+                std::string expected;
+                std::string s;
+
+                jsoncons::utility::dtoa_fixed(val, precision, '.', expected, std::false_type());
+                jsoncons::utility::dtoa_fixed(val, precision, '.', s, std::true_type());
+                CHECK(s == expected);
+
+                expected.clear();
+                s.clear();
+                jsoncons::utility::dtoa_scientific(val, precision, '.', expected, std::false_type());
+                jsoncons::utility::dtoa_scientific(val, precision, '.', s, std::true_type());
+                CHECK(s == expected);
+
+                expected.clear();
+                s.clear();
+                jsoncons::utility::dtoa_general(val, precision, '.', expected, std::false_type());
+                jsoncons::utility::dtoa_general(val, precision, '.', s, std::true_type());
+                CHECK(s == expected);
+            }
+        }
+    }
+}
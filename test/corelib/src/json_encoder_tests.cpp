@@ -116,3 +116,47 @@ TEMPLATE_TEST_CASE("test_json_encoder_reset", "",
     f.encoder.flush();
     CHECK(f.string2() == R"(["foo",42])");
 }
+
+TEST_CASE("json_encoder escape long strings")
+{
+    // Special characters at every position of strings longer than the bulk copy blocks
+    const std::vector<std::pair<std::string,std::string>> specials = {
+        {"\"", "\\\""}, {"\\", "\\\\"}, {"\n", "\\n"}, {"\x01", "\\u0001"}, {"\x1f", "\\u001F"},
+        {"\x7f", "\\u007F"}, {"/", "/"}, {"\xc3\xa9", "\xc3\xa9"}, {"\xe2\x82\xac", "\xe2\x82\xac"}
+    };
+    const std::string text(70, 'a');
+
+    for (const auto& special : specials)
+    {
+        for (std::size_t i = 0; i <= text.size(); ++i)
+        {
+            std::string s = text.substr(0, i) + special.first + text.substr(i);
+            std::string expected = "\"" + text.substr(0, i) + special.second + text.substr(i) + "\"";
+
+            std::string buffer;
+            encode_json(json(s), buffer);
+            CHECK(buffer == expected);
+
+            buffer.clear();
+            encode_json(json(s), buffer, indenting::indent);
+            CHECK(buffer == expected);
+        }
+    }
+
+    SECTION("escape_solidus and escape_all_non_ascii")
+    {
+        auto options = json_options{}
+            .escape_solidus(true)
+            .escape_all_non_ascii(true);
+
+        for (std::size_t i = 0; i <= text.size(); ++i)
+        {
+            std::string s = text.substr(0, i) + "/" + text.substr(i) + "\xc3\xa9";
+            std::string expected = "\"" + text.substr(0, i) + "\\/" + text.substr(i) + "\\u00E9\"";
+
+            std::string buffer;
+            encode_json(json(s), buffer, options);
+            CHECK(buffer == expected);
+        }
+    }
+}
@@ -0,0 +1,165 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <catch/catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_lines(std::size_t count)
+    {
+        std::string s;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            s.append("{\"id\":");
+            s.append(std::to_string(i));
+            s.append(",\"tags\":[\"a\",\"b\"],\"name\":\"line ");
+            s.append(std::to_string(i));
+            s.append("\"}\n");
+        }
+        return s;
+    }
+
+} // namespace
+
+TEST_CASE("json_lines_reader tests")
+{
+    std::string input = make_lines(1000);
+
+    SECTION("ordered")
+    {
+        auto options = json_lines_options{}
+            .thread_count(4)
+            .chunk_size(256);
+        json_lines_reader reader(input, options);
+
+        std::vector<int64_t> ids;
+        reader.read<json>([&](json&& j) {ids.push_back(j.at("id").as<int64_t>());});
+
+        REQUIRE(ids.size() == 1000);
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            CHECK(ids[i] == static_cast<int64_t>(i));
+        }
+    }
+    SECTION("unordered")
+    {
+        auto options = json_lines_options{}
+            .thread_count(4)
+            .chunk_size(100)
+            .ordered(false)
+            .max_chunks_in_flight(3);
+        json_lines_reader reader(input, options);
+
+        std::vector<bool> seen(1000, false);
+        std::size_t count = 0;
+        reader.read<ojson>([&](ojson&& j)
+        {
+            seen[j.at("id").as<std::size_t>()] = true;
+            ++count;
+        });
+
+        CHECK(count == 1000);
+        CHECK(std::find(seen.begin(), seen.end(), false) == seen.end());
+    }
+    SECTION("single thread")
+    {
+        json_lines_reader reader(input, json_lines_options{}.thread_count(1));
+        std::size_t count = 0;
+        reader.read<json>([&](json&&) {++count;});
+        CHECK(count == 1000);
+    }
+}
+
+TEST_CASE("json_lines_reader blank lines and line endings")
+{
+    std::string input = "\xEF\xBB\xBF[1]\r\n\r\n  \n{\"a\":2}\r\n3";
+
+    json_lines_reader reader(input, json_lines_options{}.thread_count(2).chunk_size(1));
+    std::vector<json> values;
+    reader.read<json>([&](json&& j) {values.push_back(std::move(j));});
+
+    REQUIRE(values.size() == 3);
+    CHECK(values[0] == json::parse("[1]"));
+    CHECK(values[1] == json::parse("{\"a\":2}"));
+    CHECK(values[2] == json(3));
+}
+
+TEST_CASE("json_lines_reader errors")
+{
+    std::string input = make_lines(500);
+    input.append("{\"id\":500,}\n");
+    input.append(make_lines(500));
+
+    auto options = json_lines_options{}
+        .thread_count(4)
+        .chunk_size(128);
+
+    SECTION("throws with line and column")
+    {
+        json_lines_reader reader(input, options);
+        std::size_t count = 0;
+        try
+        {
+            reader.read<json>([&](json&&) {++count;});
+            CHECK(false);
+        }
+        catch (const ser_error& e)
+        {
+            CHECK(e.code() == json_errc::extra_comma);
+            CHECK(e.line() == 501);
+            CHECK(e.column() == 12);
+        }
+        CHECK(count == 500);
+    }
+    SECTION("error code")
+    {
+        json_lines_reader reader(input, options.ordered(false));
+        std::error_code ec;
+        reader.read<json>([](json&&) {}, ec);
+        CHECK(ec == json_errc::extra_comma);
+        CHECK(reader.line() == 501);
+    }
+    SECTION("exception from callback")
+    {
+        json_lines_reader reader(input, options);
+        std::size_t count = 0;
+        CHECK_THROWS_AS(reader.read<json>([&](json&&)
+        {
+            if (++count == 10)
+            {
+                throw std::runtime_error("stop");
+            }
+        }), std::runtime_error);
+    }
+}
+
+TEST_CASE("json_lines_reader file")
+{
+    std::string path = "./corelib/output/json_lines_reader_test.jsonl";
+    std::string input = make_lines(200);
+    {
+        std::ofstream os(path, std::ios::binary);
+        os << input;
+    }
+
+    json_lines_reader reader(file_path_arg, path, json_lines_options{}.thread_count(3).chunk_size(512));
+    std::size_t count = 0;
+    reader.read<json>([&](json&& j)
+    {
+        CHECK(j.at("id").as<std::size_t>() == count);
+        ++count;
+    });
+    CHECK(count == 200);
+    std::remove(path.c_str());
+
+    CHECK_THROWS_AS(json_lines_reader(file_path_arg, "./corelib/output/does-not-exist.jsonl"), ser_error);
+}
@@ -5,6 +5,7 @@
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons/json_parser.hpp>
 #include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_cursor.hpp>
 #include <jsoncons/diagnostics_visitor.hpp>
 #include <sstream>
 #include <iostream>
@@ -390,3 +391,139 @@ TEST_CASE("json_parser skip space tests")
     }
 }
 
+
+namespace {
+
+    class event_recorder : public default_json_visitor
+    {
+    public:
+        std::vector<std::string> events;
+    private:
+        void record(const std::string& event, const ser_context& context)
+        {
+            events.push_back(event + "@" + std::to_string(context.line()) + ":" + std::to_string(context.column()) 
+                + ":" + std::to_string(context.begin_position()));
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("{", context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context& context, std::error_code&) override
+        {
+            record("}", context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("[", context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context& context, std::error_code&) override
+        {
+            record("]", context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context& context, std::error_code&) override
+        {
+            record("key " + std::string(name), context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code&) override
+        {
+            record("string " + std::string(value) + " " + std::to_string(static_cast<int>(tag)), context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("null", context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record(value ? "true" : "false", context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("uint64 " + std::to_string(value), context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("int64 " + std::to_string(value), context);
+            JSONCONS_VISITOR_RETURN;
+        }
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag, const ser_context& context, std::error_code&) override
+        {
+            record("double " + std::to_string(value), context);
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+    std::vector<std::string> record_events(const std::string& input, json_options options, std::error_code& ec)
+    {
+        event_recorder recorder;
+        json_string_reader reader(input, recorder, options);
+        reader.read(ec);
+        if (ec)
+        {
+            recorder.events.push_back(ec.message() + "@" + std::to_string(reader.line()) + ":" + std::to_string(reader.column()));
+        }
+        return recorder.events;
+    }
+
+} // namespace
+
+TEST_CASE("json_parser structural_index tests")
+{
+    std::vector<std::string> inputs = {
+        R"({"a":1,"b":[true,false,null],"c":{"d":-1.5e3,"e":"f\"g\\"}})",
+        "  [ 1 ,\n 2 ,\r\n\t\"three\" , { \"four\" : 4 } ] \n ",
+        R"("a string")",
+        R"(-0.25)",
+        R"([[[[[]]]],{},[{}],"é𝄞"])",
+        R"(["long string with an escaped quote \" that runs past the first sixty four characters of input", 1234567890123456789012])",
+        "[1,2,3 /* comment */, 4] // comment\n",
+        "[1,2,]",
+        "{\"a\":1,}",
+        "[1 2]",
+        "{\"a\" 1}",
+        "[tru]",
+        "[nul, 1]",
+        "[\"abc",
+        "{\"a\":[1,2",
+        "[1,\x01 2]",
+        "]",
+        "[1] [2]",
+        "{\"a\":NaN}"
+    };
+
+    auto options = json_options{}.allow_trailing_comma(true);
+
+    for (const auto& input : inputs)
+    {
+        std::error_code ec1;
+        std::error_code ec2;
+        auto expected = record_events(input, options, ec1);
+        auto actual = record_events(input, json_options(options).structural_index(true), ec2);
+        CHECK(ec1 == ec2);
+        CHECK(expected == actual);
+    }
+}
+
+TEST_CASE("json_parser structural_index with cursor")
+{
+    std::string input = R"({"a":[1,2,{"b":"c"}],"d":"e","f":[]})";
+
+    json_string_cursor cursor1(input);
+    json_string_cursor cursor2(input, json_options{}.structural_index(true));
+    for (; !cursor1.done(); cursor1.next(), cursor2.next())
+    {
+        REQUIRE_FALSE(cursor2.done());
+        CHECK(cursor1.current().event_type() == cursor2.current().event_type());
+        CHECK(cursor1.context().column() == cursor2.context().column());
+    }
+    CHECK(cursor2.done());
+}
@@ -0,0 +1,173 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/lazy_json.hpp>
+#include <catch/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("lazy_json tests")
+{
+    std::string input = R"(
+{
+    "id": 12345,
+    "route": {"region": "eu-west", "weight": -2.5e1, "hops": [3, 1, 2]},
+    "escaped\"key": "line\nbreak \u00e9",
+    "flags": [true, false, null],
+    "empty": {},
+    "nothing": [],
+    "big": 18446744073709551615,
+    "negative": -9223372036854775808
+}
+    )";
+
+    lazy_json doc = lazy_json::parse(input);
+
+    SECTION("types")
+    {
+        CHECK(doc.type() == json_type::object_value);
+        CHECK(doc.size() == 8);
+        CHECK(doc["id"].type() == json_type::uint64_value);
+        CHECK(doc["negative"].type() == json_type::int64_value);
+        CHECK(doc["route"]["weight"].type() == json_type::double_value);
+        CHECK(doc["flags"][0].is_bool());
+        CHECK(doc["flags"][2].is_null());
+        CHECK(doc["empty"].is_object());
+        CHECK(doc["empty"].empty());
+        CHECK(doc["nothing"].is_array());
+        CHECK(doc["nothing"].empty());
+    }
+    SECTION("as")
+    {
+        CHECK(doc["id"].as<int>() == 12345);
+        CHECK(doc["big"].as<uint64_t>() == 18446744073709551615ull);
+        CHECK(doc["negative"].as<int64_t>() == (std::numeric_limits<int64_t>::lowest)());
+        CHECK(doc["route"]["weight"].as<double>() == -25.0);
+        CHECK(doc["route"]["region"].as<std::string>() == "eu-west");
+        CHECK(doc["route"]["region"].as_string_view() == "eu-west");
+        CHECK(doc["route"]["hops"][2].as<int>() == 2);
+        CHECK(doc["flags"][0].as<bool>());
+        CHECK_FALSE(doc["flags"][1].as<bool>());
+        CHECK(doc["escaped\"key"].as<std::string>() == "line\nbreak \xc3\xa9");
+        CHECK_THROWS(doc["escaped\"key"].as_string_view());
+        CHECK(doc["route"]["hops"].as<std::vector<int>>() == std::vector<int>{3, 1, 2});
+        CHECK(doc["big"].raw_text() == "18446744073709551615");
+    }
+    SECTION("materialize")
+    {
+        json j = doc.as<json>();
+        CHECK(j == json::parse(input));
+        CHECK(doc["route"].as<ojson>().to_string() == R"({"region":"eu-west","weight":-25.0,"hops":[3,1,2]})");
+    }
+    SECTION("errors on access")
+    {
+        CHECK_THROWS_AS(doc.at("missing"), key_not_found);
+        CHECK_THROWS(doc["route"]["hops"][3]);
+        CHECK_THROWS(doc["id"]["x"]);
+        CHECK_THROWS(doc["route"]["region"].as<int>());
+        CHECK_FALSE(doc.contains("missing"));
+        CHECK(doc.contains("escaped\"key"));
+    }
+    SECTION("object_range")
+    {
+        std::vector<std::string> keys;
+        for (const auto& member : doc.root().object_range())
+        {
+            keys.push_back(member.key());
+        }
+        REQUIRE(keys.size() == 8);
+        CHECK(keys[0] == "id");
+        CHECK(keys[2] == "escaped\"key");
+        CHECK(keys[7] == "negative");
+    }
+    SECTION("array_range")
+    {
+        int sum = 0;
+        for (auto item : doc["route"]["hops"].array_range())
+        {
+            sum += item.as<int>();
+        }
+        CHECK(sum == 6);
+    }
+}
+
+TEST_CASE("lazy_json ownership")
+{
+    lazy_json doc = lazy_json::parse(std::string(R"({"a":[1,"x"]})"));
+    lazy_json other = std::move(doc);
+    CHECK(other["a"][1].as<std::string>() == "x");
+
+    std::string input = "[1,2,3]";
+    lazy_json doc2 = lazy_json::parse(string_view(input));
+    other = std::move(doc2);
+    CHECK(other.size() == 3);
+    CHECK(other.index_size() == 4);
+}
+
+TEST_CASE("lazy_json parse errors")
+{
+    auto check_error = [](const std::string& input, json_errc expected)
+    {
+        try
+        {
+            lazy_json::parse(string_view(input));
+            CHECK(false);
+        }
+        catch (const ser_error& e)
+        {
+            CHECK(e.code() == expected);
+        }
+    };
+
+    check_error("", json_errc::unexpected_eof);
+    check_error("[1,2", json_errc::unexpected_eof);
+    check_error("[1,]", json_errc::extra_comma);
+    check_error("{\"a\":1,}", json_errc::extra_comma);
+    check_error("{\"a\" 1}", json_errc::expected_colon);
+    check_error("{1:1}", json_errc::expected_key);
+    check_error("[1 2]", json_errc::expected_comma_or_rbracket);
+    check_error("{\"a\":1]", json_errc::expected_comma_or_rbrace);
+    check_error("[01]", json_errc::leading_zero);
+    check_error("[1.]", json_errc::invalid_number);
+    check_error("[tru]", json_errc::invalid_value);
+    check_error("[\"\\x\"]", json_errc::illegal_escaped_character);
+    check_error("[\"\\u12\"]", json_errc::invalid_unicode_escape_sequence);
+    check_error("[\"a\tb\"]", json_errc::illegal_control_character);
+    check_error("[] x", json_errc::extra_character);
+    check_error("]", json_errc::unexpected_rbracket);
+
+    SECTION("position")
+    {
+        try
+        {
+            lazy_json::parse(string_view("{\n  \"a\": [1,\n  2,,]}"));
+            CHECK(false);
+        }
+        catch (const ser_error& e)
+        {
+            CHECK(e.line() == 3);
+            CHECK(e.column() == 5);
+        }
+    }
+    SECTION("max nesting depth")
+    {
+        std::string input(10, '[');
+        input.append(10, ']');
+        auto options = json_options{}.max_nesting_depth(5);
+        REQUIRE_THROWS(lazy_json::parse(string_view(input), options));
+        CHECK(lazy_json::parse(string_view(input)).index_size() == 10);
+    }
+}
+
+TEST_CASE("wlazy_json tests")
+{
+    std::wstring input = L"{\"name\":\"caf\\u00e9\",\"n\":[1,2]}";
+    wlazy_json doc = wlazy_json::parse(wstring_view(input));
+    CHECK(doc[L"name"].as<std::wstring>() == L"caf\u00e9");
+    CHECK(doc[L"n"][1].as<int>() == 2);
+}
@@ -9,6 +9,8 @@
 #include <ctime>
 #include <map>
 #include <iterator>
+#include <algorithm>
+#include <string>
 #include <catch/catch.hpp>
 
 using namespace jsoncons;
@@ -67,6 +69,99 @@ TEST_CASE("ojson parse_duplicate_names")
     }
 }
 
+namespace {
+
+    void check_members(const ojson& doc, const std::vector<std::string>& keys)
+    {
+        REQUIRE(doc.size() == keys.size());
+        std::size_t i = 0;
+        for (const auto& member : doc.object_range())
+        {
+            CHECK(member.key() == keys[i]);
+            CHECK(doc.contains(keys[i]));
+            CHECK(doc.at(keys[i]) == member.value());
+            ++i;
+        }
+        CHECK_FALSE(doc.contains("missing"));
+    }
+
+} // namespace
+
+TEST_CASE("ojson object with many members")
+{
+    ojson doc(jsoncons::json_object_arg);
+    std::vector<std::string> keys;
+    for (int i = 0; i < 200; ++i)
+    {
+        keys.push_back("key" + std::to_string((i * 37) % 200));
+        doc.insert_or_assign(keys.back(), i);
+    }
+
+    SECTION("lookup preserves order")
+    {
+        check_members(doc, keys);
+
+        doc.insert_or_assign("key5", -1);
+        CHECK(doc.size() == 200);
+        CHECK(doc.at("key5") == -1);
+        check_members(doc, keys);
+
+        auto result = doc.try_emplace("key7", -2);
+        CHECK_FALSE(result.second);
+        CHECK(doc.at("key7") != -2);
+    }
+
+    SECTION("erase")
+    {
+        doc.erase("key0");
+        keys.erase(std::find(keys.begin(), keys.end(), "key0"));
+        check_members(doc, keys);
+
+        auto it = doc.find("key100");
+        REQUIRE(bool(it != doc.object_range().end()));
+        doc.erase(it);
+        keys.erase(std::find(keys.begin(), keys.end(), "key100"));
+        check_members(doc, keys);
+
+        doc.erase(doc.object_range().begin() + 10, doc.object_range().begin() + 20);
+        keys.erase(keys.begin() + 10, keys.begin() + 20);
+        check_members(doc, keys);
+
+        while (doc.size() > 5)
+        {
+            doc.erase(keys.front());
+            keys.erase(keys.begin());
+            CHECK(doc.contains(keys.front()));
+            CHECK_FALSE(doc.contains("key0"));
+        }
+        check_members(doc, keys);
+
+        doc.insert_or_assign("key0", 0);
+        keys.push_back("key0");
+        check_members(doc, keys);
+    }
+
+    SECTION("copy, swap and parse")
+    {
+        ojson other(doc);
+        check_members(other, keys);
+
+        ojson empty(jsoncons::json_object_arg);
+        empty.swap(other);
+        check_members(empty, keys);
+
+        ojson parsed = ojson::parse(doc.to_string());
+        check_members(parsed, keys);
+        CHECK(parsed == doc);
+
+        ojson assigned;
+        assigned = parsed;
+        assigned.insert_or_assign("added", true);
+        keys.push_back("added");
+        check_members(assigned, keys);
+    }
+}
+
 TEST_CASE("ojson object erase with iterator")
 {
     SECTION("ojson erase with iterator")
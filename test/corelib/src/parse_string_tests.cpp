@@ -126,3 +126,77 @@ TEST_CASE("test_parse_big_string2")
 #endif
 
 
+
+TEST_CASE("parse long string with special character at each position")
+{
+    const std::string text(70, 'a');
+
+    SECTION("escape")
+    {
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            std::string expected = text;
+            expected[i] = '\"';
+            std::string input = "\"" + text.substr(0, i) + "\\\"" + text.substr(i + 1) + "\"";
+
+            json j = json::parse(input);
+            CHECK(expected == j.as<std::string>());
+            CHECK(j.tag() == semantic_tag::none);
+        }
+    }
+    SECTION("no escape")
+    {
+        std::string input = "\"" + text + "\"";
+        json j = json::parse(input);
+        CHECK(text == j.as<std::string>());
+        CHECK(j.tag() == semantic_tag::noesc);
+    }
+    SECTION("control character")
+    {
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            std::string input = "\"" + text + "\"";
+            input[i + 1] = '\x01';
+
+            std::error_code ec;
+            json_decoder<json> decoder;
+            json_string_reader reader(input, decoder);
+            reader.read(ec);
+            CHECK(ec == json_errc::illegal_control_character);
+            CHECK(reader.column() == i + 3);
+        }
+    }
+}
+
+TEST_CASE("parse long string with multi-byte UTF-8")
+{
+    std::string text(40, 'a');
+    text.append("\xc3\xa9\xe2\x82\xac");
+    text.append(40, 'b');
+
+    SECTION("valid")
+    {
+        for (std::size_t i = 1; i < text.size(); ++i)
+        {
+            std::string input = "\"" + text + "\"";
+            std::istringstream is(input);
+            json_decoder<json> decoder;
+            json_stream_reader reader(stream_source<char>(is,i), decoder);
+            std::error_code ec;
+            reader.read(ec);
+            REQUIRE_FALSE(ec);
+            CHECK(text == decoder.get_result().as<std::string>());
+        }
+    }
+    SECTION("invalid")
+    {
+        std::string input = "\"" + text + "\"";
+        input[42] = '\xff';
+
+        std::error_code ec;
+        json_decoder<json> decoder;
+        json_string_reader reader(input, decoder);
+        reader.read(ec);
+        CHECK(ec == json_errc::expected_continuation_byte);
+    }
+}
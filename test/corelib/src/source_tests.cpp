@@ -3,7 +3,11 @@
 
 #include <jsoncons/json.hpp>
 #include <jsoncons/source.hpp>
+#include <jsoncons/mmap_source.hpp>
+#include <fstream>
+#include <map>
 #include <sstream>
+#include <string>
 #include <vector>
 #include <utility>
 #include <ctime>
@@ -531,3 +535,130 @@ TEST_CASE("binary_iterator_stream source tests")
         CHECK(9 == source.position());
     }
 }
+
+TEST_CASE("mmap_source tests")
+{
+    SECTION("regular file")
+    {
+        std::ifstream is("./corelib/input/address-book.json", std::ios::binary);
+        std::ostringstream os;
+        os << is.rdbuf();
+        std::string expected = os.str();
+        REQUIRE_FALSE(expected.empty());
+
+        jsoncons::mmap_source<char> source("./corelib/input/address-book.json");
+        CHECK_FALSE(source.is_error());
+        CHECK_FALSE(source.eof());
+#if defined(JSONCONS_HAS_MMAP)
+        CHECK(source.is_mapped());
+#endif
+        auto p = source.peek();
+        CHECK(p.value == expected[0]);
+
+        std::string s;
+        while (!source.eof())
+        {
+            auto buf = source.read_buffer();
+            s.append(buf.data(), buf.size());
+        }
+        CHECK(s == expected);
+        CHECK(source.position() == expected.size());
+    }
+    SECTION("read and ignore")
+    {
+        std::ifstream is("./corelib/input/address-book.json", std::ios::binary);
+        std::ostringstream os;
+        os << is.rdbuf();
+        std::string expected = os.str();
+
+        jsoncons::mmap_source<char> source("./corelib/input/address-book.json");
+        source.ignore(3);
+        char buf[5];
+        CHECK(5 == source.read(buf, 5));
+        CHECK(std::string(buf, 5) == expected.substr(3, 5));
+        CHECK(8 == source.position());
+    }
+    SECTION("missing file")
+    {
+        jsoncons::mmap_source<char> source("./corelib/input/does-not-exist.json");
+        CHECK(source.is_error());
+        CHECK(source.eof());
+        CHECK(source.read_buffer().size() == 0);
+    }
+#if defined(JSONCONS_HAS_MMAP)
+    SECTION("character device")
+    {
+        jsoncons::mmap_source<char> source("/dev/null");
+        CHECK_FALSE(source.is_error());
+        CHECK_FALSE(source.is_mapped());
+        CHECK(source.peek().eof);
+        CHECK(source.eof());
+    }
+#endif
+#if defined(JSONCONS_HAS_MMAP) && defined(__linux__)
+    SECTION("pipe")
+    {
+        std::string data = "[1,2,3,\"four\",{\"five\":5}]";
+        int fds[2];
+        REQUIRE(::pipe(fds) == 0);
+        REQUIRE(::write(fds[1], data.data(), data.size()) == static_cast<::ssize_t>(data.size()));
+        ::close(fds[1]);
+
+        std::string path = "/dev/fd/" + std::to_string(fds[0]);
+        jsoncons::mmap_source<char> source(path, 4); // small buffer, many reads
+        CHECK_FALSE(source.is_mapped());
+
+        std::string s;
+        while (!source.eof())
+        {
+            auto buf = source.read_buffer();
+            s.append(buf.data(), buf.size());
+        }
+        ::close(fds[0]);
+        CHECK(s == data);
+        CHECK_FALSE(source.is_error());
+    }
+#endif
+}
+
+TEST_CASE("parse file with mmap_source")
+{
+    std::string path = "./corelib/input/address-book.json";
+    std::ifstream is(path);
+    jsoncons::json expected = jsoncons::json::parse(is);
+
+    SECTION("json_file_reader")
+    {
+        jsoncons::json_decoder<jsoncons::json> decoder;
+        jsoncons::json_file_reader reader(jsoncons::mmap_source<char>(path), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+    }
+    SECTION("json_file_cursor")
+    {
+        jsoncons::mmap_source<char> source(path);
+        jsoncons::json_file_cursor cursor(std::move(source));
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        CHECK(count > 0);
+    }
+    SECTION("decode_json")
+    {
+        auto j = jsoncons::decode_json<jsoncons::json>(jsoncons::file_path_arg, path);
+        CHECK(j == expected);
+
+        auto result = jsoncons::try_decode_json<std::map<std::string,std::vector<std::map<std::string,std::string>>>>(
+            jsoncons::file_path_arg, path);
+        REQUIRE(result);
+        CHECK(result->at("address-book").size() == expected["address-book"].size());
+    }
+    SECTION("missing file")
+    {
+        auto result = jsoncons::try_decode_json<jsoncons::json>(jsoncons::file_path_arg, "./corelib/input/does-not-exist.json");
+        REQUIRE_FALSE(result);
+        CHECK(result.error().code() == jsoncons::json_errc::source_error);
+    }
+}
@@ -4,12 +4,102 @@
 #include <jsoncons/json.hpp>
 #include <catch/catch.hpp>
 
+#include <cstdint>
+#include <limits>
+#include <string>
+
 using namespace jsoncons;
 
 TEST_CASE("utility::from_integer tests")
 {
-    SECTION("")
+    SECTION("powers of ten and their neighbours")
+    {
+        uint64_t n = 1;
+        for (int i = 0; i < 20; ++i)
+        {
+            for (uint64_t val : {n - 1, n, n + 1})
+            {
+                std::string s;
+                std::size_t length = jsoncons::utility::from_integer(val, s);
+                CHECK(s == std::to_string(val));
+                CHECK(length == s.size());
+            }
+            if (i < 19)
+            {
+                n *= 10;
+            }
+        }
+    }
+    SECTION("limits")
+    {
+        std::string s;
+        jsoncons::utility::from_integer((std::numeric_limits<uint64_t>::max)(), s);
+        CHECK(s == "18446744073709551615");
+
+        s.clear();
+        jsoncons::utility::from_integer((std::numeric_limits<int64_t>::max)(), s);
+        CHECK(s == "9223372036854775807");
+
+        s.clear();
+        std::size_t length = jsoncons::utility::from_integer((std::numeric_limits<int64_t>::lowest)(), s);
+        CHECK(s == "-9223372036854775808");
+        CHECK(length == s.size());
+
+        s.clear();
+        jsoncons::utility::from_integer((std::numeric_limits<int8_t>::lowest)(), s);
+        CHECK(s == "-128");
+
+        s.clear();
+        jsoncons::utility::from_integer(uint16_t(65535), s);
+        CHECK(s == "65535");
+    }
+    SECTION("negative values")
     {
+        for (int64_t val : {int64_t(-1), int64_t(-9), int64_t(-10), int64_t(-99), int64_t(-100), int64_t(-123456789012)})
+        {
+            std::string s;
+            std::size_t length = jsoncons::utility::from_integer(val, s);
+            CHECK(s == std::to_string(val));
+            CHECK(length == s.size());
+        }
     }
+    SECTION("wide characters")
+    {
+        std::wstring s;
+        jsoncons::utility::from_integer(-1234567, s);
+        CHECK(s == L"-1234567");
+    }
+#if defined(JSONCONS_HAS_INT128)
+    SECTION("128 bit integers")
+    {
+        std::string s;
+        jsoncons::utility::from_integer(static_cast<int128_type>(-1) * (static_cast<int128_type>(1) << 100), s);
+        CHECK(s == "-1267650600228229401496703205376");
+    }
+#endif
 }
 
+TEST_CASE("detail::count_digits tests")
+{
+    CHECK(jsoncons::detail::count_digits(0) == 1);
+    uint64_t n = 1;
+    for (int i = 1; i <= 20; ++i)
+    {
+        CHECK(jsoncons::detail::count_digits(n) == i);
+        if (i > 1)
+        {
+            CHECK(jsoncons::detail::count_digits(n - 1) == i - 1);
+        }
+        if (i < 20)
+        {
+            n *= 10;
+        }
+    }
+    CHECK(jsoncons::detail::count_digits((std::numeric_limits<uint64_t>::max)()) == 20);
+    for (int bits = 0; bits < 64; ++bits)
+    {
+        uint64_t val = uint64_t(1) << bits;
+        CHECK(jsoncons::detail::count_digits(val) == static_cast<int>(std::to_string(val).size()));
+        CHECK(jsoncons::detail::count_digits(val - 1) == static_cast<int>(std::to_string(val - 1).size()));
+    }
+}
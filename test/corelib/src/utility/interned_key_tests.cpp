@@ -0,0 +1,128 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/utility/interned_key.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+using interned_key = jsoncons::utility::basic_interned_key<char>;
+using ijson = jsoncons::basic_json<char,jsoncons::interned_keys_policy>;
+
+TEST_CASE("basic_interned_key tests")
+{
+    SECTION("construct and compare")
+    {
+        interned_key a("foo");
+        interned_key b(std::string("foo"));
+        interned_key c("bar", 3);
+        interned_key empty;
+
+        CHECK(a == b);
+        CHECK_FALSE(a.shares_with(b));
+        CHECK(a != c);
+        CHECK(c < a);
+        CHECK(a.compare(c) > 0);
+        CHECK(a == "foo");
+        CHECK("foo" == a);
+        CHECK(a == std::string("foo"));
+        CHECK(a.size() == 3);
+        CHECK(std::string(a.c_str()) == "foo");
+        CHECK(empty.empty());
+        CHECK(std::string(empty.c_str()).empty());
+        CHECK(empty < a);
+    }
+    SECTION("copies share")
+    {
+        interned_key a("foo");
+        interned_key b(a);
+        CHECK(a.shares_with(b));
+        CHECK(a.use_count() == 2);
+        interned_key c(std::move(b));
+        CHECK(a.use_count() == 2);
+        CHECK(b.empty());
+        c = interned_key("other");
+        CHECK(a.use_count() == 1);
+        CHECK(c == "other");
+    }
+}
+
+TEST_CASE("interned_key_pool tests")
+{
+    jsoncons::utility::interned_key_pool<interned_key> pool;
+
+    std::vector<interned_key> keys;
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string s = "key" + std::to_string(i % 100);
+        keys.push_back(pool.get(s.data(), s.size()));
+    }
+    CHECK(pool.size() == 100);
+    for (int i = 0; i < 1000; ++i)
+    {
+        CHECK(keys[i] == "key" + std::to_string(i % 100));
+        CHECK(keys[i].shares_with(keys[i % 100]));
+    }
+    CHECK(keys[0].use_count() == 11); // ten in keys and one in the pool
+}
+
+TEST_CASE("interned_keys_policy tests")
+{
+    std::string input = R"(
+[
+    {"name" : "Jane Roe", "email" : "jane.roe@example.com", "age" : 30},
+    {"name" : "John Doe", "email" : "john.doe@example.com", "age" : 40},
+    {"email" : "mary.major@example.com", "name" : "Mary Major", "age" : 50}
+]
+    )";
+
+    SECTION("parsed keys are shared")
+    {
+        ijson doc = ijson::parse(input);
+        REQUIRE(doc.size() == 3);
+
+        auto first = doc[0].object_range().begin();
+        for (std::size_t i = 1; i < doc.size(); ++i)
+        {
+            auto it = doc[i].object_range().begin();
+            for (auto jt = first; jt != doc[0].object_range().end(); ++jt, ++it)
+            {
+                CHECK(it->key() == jt->key());
+                CHECK(it->key().shares_with(jt->key()));
+            }
+        }
+        CHECK(doc[2]["name"].as<std::string>() == "Mary Major");
+        CHECK(doc[1].at("age").as<int>() == 40);
+        CHECK(doc[0].contains("email"));
+        CHECK_FALSE(doc[0].contains("phone"));
+    }
+
+    SECTION("same document as json")
+    {
+        ijson doc = ijson::parse(input);
+        json expected = json::parse(input);
+        CHECK(doc.to_string() == expected.to_string());
+
+        ijson copy(doc);
+        CHECK(copy == doc);
+        copy[0].insert_or_assign("phone", "555-1234");
+        copy[1].erase("email");
+        CHECK(copy != doc);
+        CHECK(copy[0]["phone"].as<std::string>() == "555-1234");
+        CHECK_FALSE(copy[1].contains("email"));
+        CHECK(doc[1].contains("email"));
+    }
+
+    SECTION("decode_json")
+    {
+        auto doc = decode_json<ijson>(input);
+        CHECK(doc.size() == 3);
+        CHECK(doc[0].object_range().begin()->key().shares_with(doc[1].object_range().begin()->key()));
+    }
+}
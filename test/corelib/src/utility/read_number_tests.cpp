@@ -3,6 +3,12 @@
 
 #include <jsoncons/utility/read_number.hpp>
 #include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 #include <iostream>
 #include <catch/catch.hpp>
 
@@ -182,3 +188,63 @@ TEST_CASE("jsoncons::utility::decstr_to_double tests")
         std::setlocale(LC_ALL, prev_loc.c_str());
     }
 }
+
+TEST_CASE("jsoncons::detail::try_decstr_to_double tests")
+{
+    SECTION("matches strtod")
+    {
+        std::vector<std::string> inputs = {
+            "0.1", "1.5", "-2.25", "3.141592653589793", "1e22", "1e23", "9007199254740993.0",
+            "2.2250738585072014e-306", "1.7976931348623157e308", "0.000001", "123456789012345678901234567890.5",
+            "7.2057594037927933e16", "4.9406564584124654e-300", "1.00000000000000011102230246251565404236316680908203125",
+            "1.00000000000000011102230246251565404236316680908203124", "1.00000000000000011102230246251565404236316680908203126",
+            "9.999999999999999e22", "1E-5", "12.34E+5", "-0.0", "00.5", "5."
+        };
+        for (const auto& s : inputs)
+        {
+            double val{0};
+            bool handled = jsoncons::detail::try_decstr_to_double(s.data(), s.length(), val);
+            if (handled)
+            {
+                CHECK(std::strtod(s.c_str(), nullptr) == val);
+            }
+        }
+    }
+    SECTION("random doubles")
+    {
+        uint64_t x = 0x9E3779B97F4A7C15ull;
+        for (int i = 0; i < 20000; ++i)
+        {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            double d;
+            std::memcpy(&d, &x, sizeof(d));
+            if (!std::isfinite(d))
+            {
+                continue;
+            }
+            char buf[40];
+            int len = snprintf(buf, sizeof(buf), "%.*g", 17 - (i % 6), d);
+            double val{0};
+            if (jsoncons::detail::try_decstr_to_double(buf, static_cast<std::size_t>(len), val))
+            {
+                CHECK(std::strtod(buf, nullptr) == val);
+            }
+        }
+    }
+    SECTION("not handled")
+    {
+        std::vector<std::string> inputs = {"", "-", ".", "1e", "1e+", "+1", "1x", "nan", "inf", "1e-400", "1e400", "4.9e-324"};
+        for (const auto& s : inputs)
+        {
+            double val{0};
+            CHECK_FALSE(jsoncons::detail::try_decstr_to_double(s.data(), s.length(), val));
+        }
+    }
+    SECTION("wchar_t")
+    {
+        std::wstring s = L"-1234.5678e-3";
+        double val{0};
+        CHECK(jsoncons::detail::try_decstr_to_double(s.data(), s.length(), val));
+        CHECK(-1.2345678 == val);
+    }
+}
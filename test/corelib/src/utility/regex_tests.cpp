@@ -0,0 +1,150 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/utility/regex.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <system_error>
+
+using jsoncons::regex_pattern;
+using jsoncons::regex_options;
+using jsoncons::regex_errc;
+
+namespace {
+
+    bool matches(const std::string& pattern, const std::string& s, regex_options options = regex_options::none)
+    {
+        return regex_pattern::compile(pattern, options).search(s);
+    }
+
+    std::string first_match(const std::string& pattern, const std::string& s)
+    {
+        std::size_t first = 0;
+        std::size_t last = 0;
+        if (!regex_pattern::compile(pattern).search(s, 0, first, last))
+        {
+            return "no match";
+        }
+        return s.substr(first, last - first);
+    }
+
+    std::error_code compile_error(const std::string& pattern)
+    {
+        std::error_code ec;
+        regex_pattern::compile(pattern, regex_options::none, ec);
+        return ec;
+    }
+
+} // namespace
+
+TEST_CASE("regex_pattern search tests")
+{
+    SECTION("anchors")
+    {
+        CHECK(matches("^abc$", "abc"));
+        CHECK_FALSE(matches("^abc$", "abcd"));
+        CHECK(matches("bc", "abcd"));
+        CHECK(matches("^$", ""));
+        CHECK(matches("", "abc"));
+    }
+    SECTION("classes")
+    {
+        CHECK(matches("^\\d+$", "0123"));
+        CHECK_FALSE(matches("^\\d+$", "01a3"));
+        CHECK(matches("^\\D$", "a"));
+        CHECK(matches("^\\w+\\s\\w+$", "foo_1 bar"));
+        CHECK(matches("^[^a-z]+$", "ABC-1"));
+        CHECK(matches("^[\\d-]+$", "12-34"));
+        CHECK(matches("^[\\-a]+$", "a-a"));
+        CHECK_FALSE(matches("^.$", "\n"));
+        CHECK(matches("^[^]$", "\n"));
+        CHECK_FALSE(matches("[]", "a"));
+    }
+    SECTION("escapes")
+    {
+        CHECK(matches("^\\t\\u0041\\x42\\cJ$", "\tAB\n"));
+        CHECK(matches("^\\/\\.\\{$", "/.{"));
+        CHECK(matches("\\bfoo\\b", "a foo b"));
+        CHECK_FALSE(matches("\\bfoo\\b", "food"));
+        CHECK(matches("o\\B", "food"));
+    }
+    SECTION("quantifiers")
+    {
+        CHECK(matches("^a{2,3}$", "aaa"));
+        CHECK_FALSE(matches("^a{2,3}$", "aaaa"));
+        CHECK(matches("^a{2}$", "aa"));
+        CHECK(matches("^a{2,}$", "aaaaa"));
+        CHECK(matches("^a{,2}$", "a{,2}"));
+        CHECK(matches("^(?:ab)+$", "ababab"));
+        CHECK(matches("^(?<pair>ab)+c$", "ababc"));
+        CHECK(matches("^colou?r$", "color"));
+        CHECK(matches("^(a|ab)(c|bcd)(d*)$", "abcd"));
+    }
+    SECTION("leftmost match, greedy or lazy")
+    {
+        CHECK(first_match("a+", "baaab") == "aaa");
+        CHECK(first_match("a+?", "baaab") == "a");
+        CHECK(first_match("<.*>", "<a><b>") == "<a><b>");
+        CHECK(first_match("<.*?>", "<a><b>") == "<a>");
+        CHECK(first_match("a|ab", "xab") == "a");
+        CHECK(first_match("x*", "abc") == "");
+        CHECK(first_match("q", "abc") == "no match");
+    }
+    SECTION("case insensitive")
+    {
+        CHECK(matches("^abc$", "AbC", regex_options::icase));
+        CHECK(matches("^[a-c]+$", "ABC", regex_options::icase));
+        CHECK_FALSE(matches("^abc$", "AbC"));
+    }
+    SECTION("utf8")
+    {
+        CHECK(matches("^.$", "\xC3\xA9"));
+        CHECK(matches("^[\xC3\xA9-\xC3\xAB]+$", "\xC3\xAA\xC3\xAB"));
+        CHECK(matches("^\\u{1F432}*$", "\xF0\x9F\x90\xB2\xF0\x9F\x90\xB2"));
+        CHECK(matches("^\\uD83D\\uDC32$", "\xF0\x9F\x90\xB2"));
+    }
+    SECTION("wide characters")
+    {
+        auto pattern = jsoncons::wregex_pattern::compile(L"^\\w+$");
+        CHECK(pattern.search(std::wstring(L"abc")));
+        CHECK_FALSE(pattern.search(std::wstring(L"a c")));
+    }
+}
+
+TEST_CASE("regex_pattern time is linear in the input")
+{
+    // Backtracking engines take time exponential in the number of x's
+    auto pattern = regex_pattern::compile("^(x+x+)+y$");
+    std::string s(5000, 'x');
+    CHECK_FALSE(pattern.search(s));
+    s.push_back('y');
+    CHECK(pattern.search(s));
+}
+
+TEST_CASE("regex_pattern errors")
+{
+    CHECK(compile_error("(a") == regex_errc::unmatched_parenthesis);
+    CHECK(compile_error("a)") == regex_errc::unmatched_parenthesis);
+    CHECK(compile_error("[a") == regex_errc::unmatched_bracket);
+    CHECK(compile_error("*a") == regex_errc::nothing_to_repeat);
+    CHECK(compile_error("a**") == regex_errc::nothing_to_repeat);
+    CHECK(compile_error("^*") == regex_errc::nothing_to_repeat);
+    CHECK(compile_error("\\a") == regex_errc::invalid_escape);
+    CHECK(compile_error("[z-a]") == regex_errc::invalid_range);
+    CHECK(compile_error("a{3,2}") == regex_errc::invalid_quantifier);
+    CHECK(compile_error("a\\") == regex_errc::unexpected_end);
+    CHECK(compile_error("(?x)") == regex_errc::invalid_group);
+    CHECK(compile_error("a{2}{3}") == regex_errc::nothing_to_repeat);
+    CHECK(compile_error("(?:a{1000}){1000}") == regex_errc::too_large);
+
+    CHECK_THROWS_AS(regex_pattern::compile("(a"), std::system_error);
+}
+
+#if defined(JSONCONS_HAS_STD_REGEX) && !defined(JSONCONS_USE_STD_REGEX)
+TEST_CASE("regex_pattern lookaround falls back to std::regex")
+{
+    CHECK(matches("a(?=b)", "ab"));
+    CHECK_FALSE(matches("a(?=b)", "ac"));
+    CHECK(matches("^(a)\\1$", "aa"));
+}
+#endif
@@ -0,0 +1,135 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+
+#include <jsoncons_ext/jmespath/jmespath.hpp>
+#include <jsoncons/json.hpp>
+
+#include <catch/catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("jmespath expression_cache tests")
+{
+    json doc = json::parse(R"({"books": [{"title": "Sayings", "price": 8.95}, {"title": "Sword", "price": 22.99}]})");
+
+    SECTION("hit returns the same expression")
+    {
+        jmespath::expression_cache<json> cache(4);
+        auto expr1 = cache.get("books[*].title");
+        auto expr2 = cache.get("books[*].title");
+        CHECK(expr1 == expr2);
+        CHECK(cache.size() == 1);
+        CHECK(expr1->evaluate(doc) == json::parse(R"(["Sayings","Sword"])"));
+    }
+    SECTION("least recently used is evicted")
+    {
+        jmespath::expression_cache<json> cache(2);
+        auto a = cache.get("a");
+        auto b = cache.get("b");
+        CHECK(cache.get("a") == a); // b is now least recently used
+        cache.get("c");
+        CHECK(cache.size() == 2);
+        CHECK(cache.get("a") == a);
+        CHECK(cache.get("b") != b);
+
+        cache.capacity(1);
+        CHECK(cache.size() == 1);
+        cache.clear();
+        CHECK(cache.size() == 0);
+    }
+    SECTION("zero capacity")
+    {
+        jmespath::expression_cache<json> cache(0);
+        auto expr = cache.get("books[0].title");
+        CHECK(expr->evaluate(doc) == json("Sayings"));
+        CHECK(cache.size() == 0);
+    }
+    SECTION("invalid expression")
+    {
+        jmespath::expression_cache<json> cache;
+        CHECK_THROWS_AS(cache.get("books[?"), jmespath::jmespath_error);
+
+        std::error_code ec;
+        auto expr = cache.get("books[?", ec);
+        CHECK(ec);
+        CHECK(expr == nullptr);
+        CHECK(cache.size() == 0);
+    }
+    SECTION("custom functions")
+    {
+        jmespath::custom_functions<json> functions;
+        functions.register_function("twice", 1,
+            [](const jsoncons::span<const jmespath::parameter<json>> params, jmespath::eval_context<json>&, std::error_code&) -> json
+            {
+                return json(params[0].value().as<double>() * 2);
+            });
+        jmespath::expression_cache<json> cache(8, functions);
+        CHECK(cache.get("twice(books[1].price)")->evaluate(doc) == json(45.98));
+    }
+}
+
+TEST_CASE("jmespath search uses the default cache")
+{
+    json doc = json::parse(R"({"books": [{"title": "Sayings", "price": 8.95}, {"title": "Sword", "price": 22.99}]})");
+    auto& cache = jmespath::default_expression_cache<json>();
+
+    std::string expr = "books[?price > `10`].title";
+    CHECK(jmespath::search(doc, expr) == json::parse(R"(["Sword"])"));
+    auto compiled = cache.get(expr);
+    CHECK(jmespath::search(doc, expr) == json::parse(R"(["Sword"])"));
+    CHECK(cache.get(expr) == compiled);
+
+    std::error_code ec;
+    CHECK(jmespath::search(doc, "books[0].title", ec) == json("Sayings"));
+    CHECK_FALSE(ec);
+    jmespath::search(doc, "books[?", ec);
+    CHECK(ec);
+
+    CHECK_THROWS_AS(jmespath::search(doc, "books[?"), jmespath::jmespath_error);
+}
+
+TEST_CASE("jmespath expression_cache concurrent evaluation")
+{
+    json doc = json::parse(R"({"items": [1, 2, 3, 4, 5, 6, 7, 8], "people": [{"name": "a", "age": 30}, {"name": "b", "age": 20}]})");
+    jmespath::expression_cache<json> cache(2);
+
+    std::vector<std::string> exprs = {"items[?@ > `4`]", "sort_by(people, &age)[*].name", "length(items)"};
+    std::vector<json> expected;
+    for (const auto& expr : exprs)
+    {
+        expected.push_back(jmespath::make_expression<json>(expr).evaluate(doc));
+    }
+
+    std::vector<int> mismatches(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < mismatches.size(); ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (std::size_t i = 0; i < 200; ++i)
+            {
+                std::size_t k = (i + t) % exprs.size();
+                if (cache.get(exprs[k])->evaluate(doc) != expected[k])
+                {
+                    ++mismatches[t];
+                }
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (auto m : mismatches)
+    {
+        CHECK(m == 0);
+    }
+    CHECK(cache.size() == 2);
+}
@@ -0,0 +1,133 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons/json.hpp>
+
+#include <catch/catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("jsonpath expression_cache tests")
+{
+    json doc = json::parse(R"({"books": [{"title": "Sayings", "price": 8.95}, {"title": "Sword", "price": 22.99}]})");
+
+    SECTION("hit returns the same expression")
+    {
+        jsonpath::expression_cache<json> cache(4);
+        auto expr1 = cache.get("$.books[*].title");
+        auto expr2 = cache.get("$.books[*].title");
+        CHECK(expr1 == expr2);
+        CHECK(cache.size() == 1);
+        CHECK(expr1->evaluate(doc) == json::parse(R"(["Sayings","Sword"])"));
+    }
+    SECTION("least recently used is evicted")
+    {
+        jsonpath::expression_cache<json> cache(2);
+        auto a = cache.get("$.a");
+        auto b = cache.get("$.b");
+        CHECK(cache.get("$.a") == a); // $.b is now least recently used
+        cache.get("$.c");
+        CHECK(cache.size() == 2);
+        CHECK(cache.get("$.a") == a);
+        CHECK(cache.get("$.b") != b);
+
+        cache.capacity(1);
+        CHECK(cache.size() == 1);
+        cache.clear();
+        CHECK(cache.size() == 0);
+    }
+    SECTION("zero capacity")
+    {
+        jsonpath::expression_cache<json> cache(0);
+        auto expr = cache.get("$.books[0].title");
+        CHECK(expr->evaluate(doc) == json::parse(R"(["Sayings"])"));
+        CHECK(cache.size() == 0);
+    }
+    SECTION("invalid path")
+    {
+        jsonpath::expression_cache<json> cache;
+        CHECK_THROWS_AS(cache.get("$.books[?("), jsonpath::jsonpath_error);
+
+        std::error_code ec;
+        auto expr = cache.get("$.books[?(", ec);
+        CHECK(ec);
+        CHECK(expr == nullptr);
+        CHECK(cache.size() == 0);
+    }
+    SECTION("custom functions")
+    {
+        jsonpath::custom_functions<json> functions;
+        functions.register_function("twice", 1,
+            [](jsoncons::span<const jsonpath::parameter<json>> params, std::error_code&) -> json
+            {
+                return json(params[0].value().as<double>() * 2);
+            });
+        jsonpath::expression_cache<json> cache(8, functions);
+        CHECK(cache.get("twice($.books[1].price)")->evaluate(doc) == json::parse("[45.98]"));
+    }
+}
+
+TEST_CASE("jsonpath json_query and json_replace use the default cache")
+{
+    json doc = json::parse(R"({"books": [{"title": "Sayings", "price": 8.95}, {"title": "Sword", "price": 22.99}]})");
+    auto& cache = jsonpath::default_expression_cache<json>();
+
+    std::string path = "$.books[?(@.price > 10)].title";
+    CHECK(jsonpath::json_query(doc, path) == json::parse(R"(["Sword"])"));
+    auto expr = cache.get(path);
+    CHECK(jsonpath::json_query(doc, path) == json::parse(R"(["Sword"])"));
+    CHECK(cache.get(path) == expr);
+
+    jsonpath::json_replace(doc, "$.books[*].price", 1.0);
+    CHECK(doc["books"][1]["price"].as<double>() == 1.0);
+
+    jsonpath::json_replace(doc, "$.books[*].title", [](const std::string&, json& title) {title = title.as<std::string>() + "!";});
+    CHECK(doc["books"][0]["title"].as<std::string>() == "Sayings!");
+}
+
+TEST_CASE("jsonpath expression_cache concurrent evaluation")
+{
+    json doc = json::parse(R"({"items": [1, 2, 3, 4, 5, 6, 7, 8]})");
+    jsonpath::expression_cache<json> cache(2);
+
+    std::vector<std::string> paths = {"$.items[?(@ > 4)]", "$.items[0:2]", "$.items[-1]"};
+    std::vector<json> expected;
+    for (const auto& path : paths)
+    {
+        expected.push_back(jsonpath::json_query(doc, path));
+    }
+
+    std::vector<int> mismatches(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < mismatches.size(); ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (std::size_t i = 0; i < 200; ++i)
+            {
+                std::size_t k = (i + t) % paths.size();
+                if (cache.get(paths[k])->evaluate(doc) != expected[k])
+                {
+                    ++mismatches[t];
+                }
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (auto m : mismatches)
+    {
+        CHECK(m == 0);
+    }
+    CHECK(cache.size() == 2);
+}
@@ -136,3 +136,46 @@ TEST_CASE("jsonpath json_query wjson test")
     }
 }
 
+
+TEST_CASE("jsonpath json_query with lazy_json")
+{
+    std::string input = R"(
+{
+    "route": {"region": "eu-west", "hops": [3, 1, 2]},
+    "store": {"book": [{"title": "Sayings", "price": 8.95}, {"title": "Sword", "price": 12.99}]},
+    "limit": 10
+}
+    )";
+    lazy_json doc = lazy_json::parse(input);
+    json j = json::parse(input);
+
+    std::vector<std::string> paths = {
+        "$",
+        "$.route",
+        "$.route.hops[1]",
+        "$['route']['region']",
+        "$.route.hops[?(@ > 1)]",
+        "$.store.book[*].title",
+        "$..price",
+        "$.store.book[?(@.price < $.limit)].title",
+        "$.route.missing",
+        "$.route['region','hops']"
+    };
+
+    for (const auto& path : paths)
+    {
+        INFO(path);
+        CHECK(jsonpath::json_query(doc.root(), path) == jsonpath::json_query(j, path));
+    }
+
+    SECTION("result paths")
+    {
+        json expected = jsonpath::json_query(j, "$.route.hops[?(@ > 1)]", jsonpath::result_options::path);
+        CHECK(jsonpath::json_query(doc.root(), "$.route.hops[?(@ > 1)]", jsonpath::result_options::path) == expected);
+    }
+    SECTION("ojson result")
+    {
+        ojson result = jsonpath::json_query<ojson>(doc.root(), "$.route");
+        CHECK(result.to_string() == R"([{"region":"eu-west","hops":[3,1,2]}])");
+    }
+}
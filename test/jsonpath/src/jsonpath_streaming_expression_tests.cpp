@@ -0,0 +1,162 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons/json.hpp>
+
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    using result_type = std::vector<std::pair<std::string,json>>;
+
+    result_type stream_results(json_string_cursor& cursor, const std::string& path)
+    {
+        result_type results;
+        jsonpath::stream_query<json>(cursor, path,
+            [&](const jsonpath::json_location& location, const json& value)
+            {
+                results.emplace_back(jsonpath::to_string(location), value);
+            });
+        std::sort(results.begin(), results.end());
+        return results;
+    }
+
+    result_type dom_results(const json& doc, const std::string& path)
+    {
+        result_type results;
+        auto expr = jsonpath::make_expression<json>(path);
+        expr.select(doc,
+            [&](const jsonpath::path_node& p, const json& value)
+            {
+                results.emplace_back(jsonpath::to_string(jsonpath::json_location(p)), value);
+            });
+        std::sort(results.begin(), results.end());
+        return results;
+    }
+
+} // namespace
+
+TEST_CASE("jsonpath streaming_expression tests")
+{
+    std::string input = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99},
+            {"category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings", "isbn": "0-395-19395-8", "price": 22.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95},
+        "0": "zero"
+    },
+    "limit": 10
+}
+    )";
+    json doc = json::parse(input);
+
+    std::vector<std::string> paths = {
+        "$",
+        "$.store.bicycle",
+        "$.store.book[1].title",
+        "$['store']['book'][0,2]['author']",
+        "$.store.book[*].author",
+        "$.store.book[1:3].title",
+        "$.store.book[::2].price",
+        "$..author",
+        "$..price",
+        "$.store.*",
+        "$..*",
+        "$..book[2]",
+        "$.store..price",
+        "$..[?(@.price > 10)]",
+        "$.store.book[0]['title','price']",
+        "$.store['0']",
+        "$.store.book[?(@.price < 10)].title",
+        "$..book[?(@.isbn)]",
+        "$.store.book[-1].title",
+        "$.store.book.length",
+        "$.store.book[?(@.price < $.limit)].title",
+        "$.missing[0]",
+        "$.limit"
+    };
+
+    for (const auto& path : paths)
+    {
+        INFO(path);
+        json_string_cursor cursor(input);
+        CHECK(stream_results(cursor, path) == dom_results(doc, path));
+    }
+}
+
+TEST_CASE("jsonpath streaming_expression streamable")
+{
+    CHECK(jsonpath::make_streaming_expression<json>("$..book[1:3].title").is_streamable());
+    CHECK(jsonpath::make_streaming_expression<json>("$.store.book[?(@.price < 10)].title").is_streamable());
+    CHECK_FALSE(jsonpath::make_streaming_expression<json>("$.store.book[-1]").is_streamable());
+    CHECK_FALSE(jsonpath::make_streaming_expression<json>("$.store.book[?(@.price < $.limit)]").is_streamable());
+
+    CHECK_THROWS_AS(jsonpath::make_streaming_expression<json>("$.store[?("), jsonpath::jsonpath_error);
+    std::error_code ec;
+    jsonpath::make_streaming_expression<json>("$.store[?(", ec);
+    CHECK(ec);
+}
+
+TEST_CASE("jsonpath streaming_expression emits values as they complete")
+{
+    std::string input = R"({"a": {"a": 1, "b": [{"a": 2}]}, "c": 3})";
+    json_string_cursor cursor(input);
+
+    std::vector<std::string> locations;
+    jsonpath::stream_query<json>(cursor, "$..a",
+        [&](const jsonpath::json_location& location, const json&)
+        {
+            locations.push_back(jsonpath::to_string(location));
+        });
+    std::vector<std::string> expected = {"$['a']['a']", "$['a']['b'][0]['a']", "$['a']"};
+    CHECK(locations == expected);
+}
+
+TEST_CASE("jsonpath streaming_expression with cbor_cursor")
+{
+    json doc = json::parse(R"({"rows": [{"id": 1, "v": [1.5, 2.5]}, {"id": 2, "v": [3.5]}, {"id": 3, "v": []}]})");
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(doc, data);
+
+    auto expr = jsonpath::make_streaming_expression<json>("$.rows[*].v[0]");
+
+    cbor::cbor_bytes_cursor cursor(data);
+    std::vector<double> values;
+    expr.evaluate(cursor,
+        [&](const jsonpath::json_location&, const json& value)
+        {
+            values.push_back(value.as<double>());
+        });
+    std::vector<double> expected = {1.5, 3.5};
+    CHECK(values == expected);
+}
+
+TEST_CASE("jsonpath streaming_expression errors")
+{
+    std::string input = R"({"a": [1, 2,)";
+    json_string_cursor cursor(input);
+
+    auto expr = jsonpath::make_streaming_expression<json>("$.a[*]");
+    std::size_t count = 0;
+    std::error_code ec;
+    expr.evaluate(cursor, [&](const jsonpath::json_location&, const json&) {++count;}, ec);
+    CHECK(ec);
+    CHECK(count == 2);
+}
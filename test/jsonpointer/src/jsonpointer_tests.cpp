@@ -588,3 +588,33 @@ TEST_CASE("jsonpointer JSON Schema tests")
 }
 
 
+
+TEST_CASE("jsonpointer get with lazy_json")
+{
+    std::string input = R"({"route": {"name": "a/b", "hops": [3, 1, 2]}, "m~n": 8})";
+    lazy_json doc = lazy_json::parse(input);
+
+    SECTION("found")
+    {
+        CHECK(jsonpointer::get(doc.root(), "/route/hops/1").as<int>() == 1);
+        CHECK(jsonpointer::get(doc.root(), "/route/name").as<std::string>() == "a/b");
+        CHECK(jsonpointer::get(doc.root(), "/m~0n").as<int>() == 8);
+        CHECK(jsonpointer::get(doc.root(), "").is_object());
+    }
+    SECTION("errors")
+    {
+        std::error_code ec;
+        jsonpointer::get(doc.root(), "/route/hops/3", ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::index_exceeds_array_size);
+
+        ec.clear();
+        jsonpointer::get(doc.root(), "/route/missing", ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::key_not_found);
+
+        ec.clear();
+        jsonpointer::get(doc.root(), "/route/name/0", ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::expected_object_or_array);
+
+        CHECK_THROWS_AS(jsonpointer::get(doc.root(), "/route/hops/x"), jsonpointer::jsonpointer_error);
+    }
+}
@@ -0,0 +1,132 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#include <jsoncons_ext/jsonschema/jsonschema.hpp>
+#include <jsoncons/json.hpp>
+
+#include <catch/catch.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using jsoncons::json;
+namespace jsonschema = jsoncons::jsonschema;
+
+TEST_CASE("json_schema_registry tests")
+{
+    json address = json::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "$id": "https://example.com/address",
+  "type": "object",
+  "properties": {
+    "street": {"type": "string"},
+    "zip": {"type": "string", "pattern": "^[0-9]{5}$"}
+  },
+  "required": ["street"]
+}
+    )");
+
+    json person = json::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "type": "object",
+  "properties": {
+    "name": {"type": "string"},
+    "address": {"$ref": "https://example.com/address"}
+  }
+}
+    )");
+
+    SECTION("add and get")
+    {
+        jsonschema::json_schema_registry<json> registry;
+        auto schema = registry.add(address);
+        REQUIRE(schema);
+        CHECK(registry.size() == 1);
+        CHECK(registry.contains("https://example.com/address"));
+        CHECK(registry.contains("https://example.com/address#"));
+        CHECK(registry.get("https://example.com/address") == schema);
+        CHECK(registry.get("https://example.com/other") == nullptr);
+
+        // the schema first registered under a key is kept
+        CHECK(registry.add(address) == schema);
+        CHECK(registry.size() == 1);
+    }
+
+    SECTION("retrieval uri")
+    {
+        jsonschema::json_schema_registry<json> registry;
+        auto schema = registry.add(address, "https://example.com/schemas/address.json");
+        CHECK(registry.size() == 2);
+        CHECK(registry.get("https://example.com/schemas/address.json") == schema);
+        CHECK(registry.get("https://example.com/address") == schema);
+    }
+
+    SECTION("references to registered schemas")
+    {
+        jsonschema::json_schema_registry<json> registry;
+        registry.add(address);
+        auto schema = registry.add(person, "https://example.com/person");
+
+        CHECK(schema->is_valid(json::parse(R"({"name": "a", "address": {"street": "b", "zip": "12345"}})")));
+        CHECK_FALSE(schema->is_valid(json::parse(R"({"name": "a", "address": {"zip": "12345"}})")));
+    }
+
+    SECTION("resolver")
+    {
+        std::atomic<int> resolved{0};
+        jsonschema::json_schema_registry<json> registry(
+            [&](const jsoncons::uri& uri) -> json
+            {
+                ++resolved;
+                if (uri.string() == "https://example.com/address")
+                {
+                    return address;
+                }
+                return json::null();
+            });
+
+        auto schema = registry.get("https://example.com/address");
+        REQUIRE(schema);
+        CHECK(registry.get("https://example.com/address") == schema);
+        CHECK(resolved == 1);
+        CHECK(registry.get("https://example.com/other") == nullptr);
+    }
+
+    SECTION("shared by threads")
+    {
+        jsonschema::json_schema_registry<json> registry;
+        registry.add(address);
+        registry.add(person, "https://example.com/person");
+
+        json valid = json::parse(R"({"name": "a", "address": {"street": "b", "zip": "12345"}})");
+        json invalid = json::parse(R"({"name": "a", "address": {"street": "b", "zip": "1234"}})");
+
+        std::atomic<int> failures{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&]()
+            {
+                for (int j = 0; j < 100; ++j)
+                {
+                    auto schema = registry.get("https://example.com/person");
+                    if (!schema || !schema->is_valid(valid) || schema->is_valid(invalid))
+                    {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        CHECK(failures == 0);
+    }
+}
@@ -78,6 +78,7 @@ namespace {
                         return jsonschema::walk_result::advance;
                     };
                     compiled.validate(test_case.at("data"), reporter);
+                    CHECK(compiled.is_valid(test_case.at("data")) == (errors == 0));
                     if (errors == 0)
                     {
                         CHECK(test_case["valid"].as<bool>());
@@ -210,3 +210,53 @@ std::string json_str = R"(
         CHECK(compiled.is_valid(jsoncons::ojson::parse(json_str)));
     }
 }
+
+TEST_CASE("jsonschema pattern tests")
+{
+    SECTION("pattern and patternProperties")
+    {
+        json schema = json::parse(R"(
+{
+    "$schema": "https://json-schema.org/draft/2020-12/schema",
+    "type": "object",
+    "properties": {
+        "id": {"type": "string", "pattern": "^[a-z]{2}-\\d{4}$"}
+    },
+    "patternProperties": {
+        "^x-": {"type": "integer"}
+    }
+}
+        )");
+        auto compiled = jsonschema::make_json_schema(schema);
+
+        CHECK(compiled.is_valid(json::parse(R"({"id": "ab-1234", "x-count": 1})")));
+        CHECK_FALSE(compiled.is_valid(json::parse(R"({"id": "ab-12345"})")));
+        CHECK_FALSE(compiled.is_valid(json::parse(R"({"x-count": "one"})")));
+    }
+
+    SECTION("pattern that backtracking engines take exponential time on")
+    {
+        json schema = json::parse(R"(
+{
+    "$schema": "https://json-schema.org/draft/2020-12/schema",
+    "type": "string",
+    "pattern": "^(a+)+$"
+}
+        )");
+        auto compiled = jsonschema::make_json_schema(schema);
+
+        CHECK_FALSE(compiled.is_valid(json(std::string(10000, 'a') + "!")));
+    }
+
+    SECTION("invalid pattern")
+    {
+        json schema = json::parse(R"(
+{
+    "$schema": "https://json-schema.org/draft/2020-12/schema",
+    "type": "string",
+    "pattern": "^(abc"
+}
+        )");
+        CHECK_THROWS_AS(jsonschema::make_json_schema(schema), jsonschema::schema_error);
+    }
+}
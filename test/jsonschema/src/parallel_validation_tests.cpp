@@ -0,0 +1,229 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#include <jsoncons_ext/jsonschema/jsonschema.hpp>
+#include <jsoncons/json.hpp>
+
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using jsoncons::json;
+using jsoncons::ojson;
+namespace jsonschema = jsoncons::jsonschema;
+
+namespace {
+
+    jsonschema::evaluation_options parallel_options()
+    {
+        return jsonschema::evaluation_options{}.thread_count(4).parallel_threshold(16);
+    }
+
+    template <typename Json>
+    std::vector<std::string> validation_messages(const jsonschema::json_schema<Json>& compiled, const Json& instance,
+        std::size_t max_errors = 0)
+    {
+        std::vector<std::string> messages;
+        compiled.validate(instance,
+            [&](const jsonschema::validation_message& msg) -> jsonschema::walk_result
+            {
+                messages.push_back(msg.eval_path().string() + " " + msg.instance_location().string() + " " + msg.message());
+                return (max_errors != 0 && messages.size() == max_errors) ? jsonschema::walk_result::abort : jsonschema::walk_result::advance;
+            });
+        return messages;
+    }
+
+} // namespace
+
+TEST_CASE("jsonschema parallel items tests")
+{
+    json schema = json::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "type": "array",
+  "items": {
+    "type": "object",
+    "properties": {
+      "id": {"type": "integer", "minimum": 0},
+      "tags": {"type": "array", "items": {"type": "string"}}
+    },
+    "required": ["id"]
+  }
+}
+    )");
+
+    json instance(jsoncons::json_array_arg);
+    for (int i = 0; i < 5000; ++i)
+    {
+        json item;
+        item["id"] = i % 97 == 0 ? -i : i;
+        json tags(jsoncons::json_array_arg);
+        for (int j = 0; j < 20; ++j)
+        {
+            if (i % 211 == 0 && j == 3)
+            {
+                tags.push_back(j);
+            }
+            else
+            {
+                tags.push_back("tag");
+            }
+        }
+        item["tags"] = std::move(tags);
+        instance.push_back(std::move(item));
+    }
+
+    auto sequential = jsonschema::make_json_schema(schema);
+    auto parallel = jsonschema::make_json_schema(schema, parallel_options());
+
+    SECTION("messages are reported in sequential order")
+    {
+        auto expected = validation_messages(sequential, instance);
+        REQUIRE(expected.size() > 50);
+        CHECK(validation_messages(parallel, instance) == expected);
+    }
+
+    SECTION("abort stops after the same message")
+    {
+        auto expected = validation_messages(sequential, instance, 10);
+        REQUIRE(expected.size() == 10);
+        CHECK(validation_messages(parallel, instance, 10) == expected);
+    }
+
+    SECTION("valid instance")
+    {
+        json valid(jsoncons::json_array_arg);
+        for (int i = 0; i < 1000; ++i)
+        {
+            json item;
+            item["id"] = i;
+            valid.push_back(std::move(item));
+        }
+        CHECK(parallel.is_valid(valid));
+        CHECK_FALSE(parallel.is_valid(instance));
+    }
+}
+
+TEST_CASE("jsonschema parallel properties tests")
+{
+    ojson schema = ojson::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "type": "object",
+  "properties": {
+    "p0": {"type": "integer"},
+    "p1": {"type": "integer", "default": 1},
+    "p2": {"type": "integer"},
+    "p3": {"type": "string", "default": "three"}
+  },
+  "patternProperties": {
+    "^s": {"type": "string"}
+  },
+  "additionalProperties": {"type": "number", "maximum": 1000}
+}
+    )");
+
+    ojson instance;
+    instance.try_emplace("p0", 0);
+    instance.try_emplace("p2", "two");
+    for (int i = 0; i < 3000; ++i)
+    {
+        instance.try_emplace("n" + std::to_string(i), i);
+        if (i % 100 == 0)
+        {
+            instance.try_emplace("s" + std::to_string(i), i);
+        }
+    }
+
+    auto sequential = jsonschema::make_json_schema(schema);
+    auto parallel = jsonschema::make_json_schema(schema, parallel_options());
+
+    SECTION("messages are reported in sequential order")
+    {
+        auto expected = validation_messages(sequential, instance);
+        REQUIRE(expected.size() > 2000);
+        CHECK(validation_messages(parallel, instance) == expected);
+    }
+
+    SECTION("defaults are patched in sequential order")
+    {
+        auto reporter = [](const jsonschema::validation_message&) -> jsonschema::walk_result
+        {
+            return jsonschema::walk_result::advance;
+        };
+
+        ojson expected_patch;
+        sequential.validate(instance, reporter, expected_patch);
+        REQUIRE(expected_patch.size() == 2);
+
+        ojson patch;
+        parallel.validate(instance, reporter, patch);
+        CHECK(patch == expected_patch);
+    }
+}
+
+TEST_CASE("jsonschema parallel unevaluated tests")
+{
+    json schema = json::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "type": "object",
+  "properties": {
+    "items": {
+      "type": "array",
+      "items": {"type": "integer"},
+      "unevaluatedItems": false
+    }
+  },
+  "additionalProperties": {"type": "integer"},
+  "unevaluatedProperties": false
+}
+    )");
+
+    json instance;
+    json items(jsoncons::json_array_arg);
+    for (int i = 0; i < 1000; ++i)
+    {
+        items.push_back(i);
+        instance["m" + std::to_string(i)] = i;
+    }
+    instance["items"] = items;
+
+    auto sequential = jsonschema::make_json_schema(schema);
+    auto parallel = jsonschema::make_json_schema(schema, parallel_options());
+
+    CHECK(sequential.is_valid(instance));
+    CHECK(parallel.is_valid(instance));
+
+    instance["items"][500] = "x";
+    instance["m500"] = "x";
+    auto expected = validation_messages(sequential, instance);
+    REQUIRE_FALSE(expected.empty());
+    CHECK(validation_messages(parallel, instance) == expected);
+}
+
+TEST_CASE("jsonschema evaluation_options thread_count tests")
+{
+    jsonschema::evaluation_options options;
+    CHECK(options.thread_count() == 1);
+    CHECK(options.parallel_threshold() == 1024);
+
+    options.thread_count(0).parallel_threshold(100);
+    CHECK(options.thread_count() == 0);
+    CHECK(options.parallel_threshold() == 100);
+    CHECK_FALSE(options == jsonschema::evaluation_options{});
+
+    json schema = json::parse(R"({"items": {"type": "integer"}})");
+    auto compiled = jsonschema::make_json_schema(schema, options);
+    json instance(jsoncons::json_array_arg);
+    for (int i = 0; i < 200; ++i)
+    {
+        instance.push_back(i);
+    }
+    CHECK(compiled.is_valid(instance));
+    instance.push_back("x");
+    CHECK_FALSE(compiled.is_valid(instance));
+}
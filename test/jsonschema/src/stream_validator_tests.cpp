@@ -0,0 +1,240 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#include <jsoncons_ext/jsonschema/jsonschema.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons/json.hpp>
+
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using jsoncons::json;
+namespace jsonschema = jsoncons::jsonschema;
+namespace cbor = jsoncons::cbor;
+
+namespace {
+
+    json resolver(const jsoncons::uri& uri)
+    {
+        std::string pathname = "./jsonschema/JSON-Schema-Test-Suite/remotes";
+        pathname += std::string(uri.path());
+
+        std::fstream is(pathname.c_str());
+        if (!is)
+        {
+            return json::null();
+        }
+
+        return json::parse(is);
+    }
+
+    std::string to_string(const jsonschema::validation_message& msg)
+    {
+        return msg.instance_location().string() + " " + msg.eval_path().string() + " " + msg.message();
+    }
+
+    std::vector<std::string> tree_messages(const jsonschema::json_schema<json>& compiled, const json& instance)
+    {
+        std::vector<std::string> messages;
+        compiled.validate(instance,
+            [&](const jsonschema::validation_message& msg) -> jsonschema::walk_result
+            {
+                messages.push_back(to_string(msg));
+                return jsonschema::walk_result::advance;
+            });
+        return messages;
+    }
+
+    std::vector<std::string> stream_messages(const jsonschema::json_schema<json>& compiled, const std::string& input)
+    {
+        std::vector<std::string> messages;
+        jsoncons::json_string_cursor cursor(input);
+        compiled.validate(cursor,
+            [&](const jsonschema::validation_message& msg) -> jsonschema::walk_result
+            {
+                messages.push_back(to_string(msg));
+                return jsonschema::walk_result::advance;
+            });
+        return messages;
+    }
+
+    void stream_tests(const std::string& fpath)
+    {
+        std::fstream is(fpath);
+        REQUIRE(is);
+
+        json tests = json::parse(is);
+        for (const auto& test_group : tests.array_range())
+        {
+            auto compiled = jsonschema::make_json_schema(test_group.at("schema"), resolver);
+            for (const auto& test_case : test_group["tests"].array_range())
+            {
+                const json& data = test_case.at("data");
+                auto expected = tree_messages(compiled, data);
+                auto actual = stream_messages(compiled, data.to_string());
+                std::sort(expected.begin(), expected.end());
+                std::sort(actual.begin(), actual.end());
+                CHECK(actual == expected);
+                if (actual != expected)
+                {
+                    std::cout << "  File: " << fpath << ", " << test_case["description"] << "\n";
+                }
+            }
+        }
+    }
+
+} // namespace
+
+TEST_CASE("jsonschema stream_validator tests")
+{
+    json schema = json::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "type": "object",
+  "properties": {
+    "name": {"type": "string", "minLength": 2},
+    "tags": {
+      "type": "array",
+      "items": {"type": "string", "pattern": "^[a-z]+$"},
+      "maxItems": 3
+    },
+    "unique": {"type": "array", "uniqueItems": true},
+    "point": {"$ref": "#/$defs/point"}
+  },
+  "required": ["name", "point"],
+  "additionalProperties": false,
+  "$defs": {
+    "point": {
+      "type": "object",
+      "properties": {"x": {"type": "number"}, "y": {"type": "number"}},
+      "required": ["x", "y"]
+    }
+  }
+}
+    )");
+
+    auto compiled = jsonschema::make_json_schema(schema);
+
+    SECTION("valid")
+    {
+        std::string input = R"({"name": "ab", "tags": ["a", "b"], "unique": [1, 2], "point": {"x": 1, "y": 2.5}})";
+        CHECK(stream_messages(compiled, input).empty());
+
+        jsoncons::json_string_cursor cursor(input);
+        CHECK(compiled.is_valid(cursor));
+    }
+
+    SECTION("messages are reported in document order")
+    {
+        std::string input = R"({"name": "a", "tags": ["a", "B", "c", "d"], "unique": [1, 1], "point": {"x": "1"}, "extra": 1})";
+
+        std::vector<std::string> expected = {
+            "/name /properties/name/minLength Number of characters must be at least 2",
+            "/tags/1 /properties/tags/items/pattern String 'B' does not match pattern '^[a-z]+$'.",
+            "/tags /properties/tags/maxItems Maximum number of items is 3 but found 4",
+            "/unique /properties/unique/uniqueItems Array items are not unique",
+            "/point/x /properties/point/$ref/properties/x/type Expected number, found string",
+            "/point /properties/point/$ref/required Required property 'y' not found.",
+            "/extra /additionalProperties/extra Additional property 'extra' not allowed by schema."
+        };
+        auto actual = stream_messages(compiled, input);
+        CHECK(actual == expected);
+
+        auto tree = tree_messages(compiled, json::parse(input));
+        std::sort(actual.begin(), actual.end());
+        std::sort(tree.begin(), tree.end());
+        CHECK(actual == tree);
+    }
+
+    SECTION("abort")
+    {
+        std::string input = R"({"name": 1, "tags": [1, 2, 3]})";
+        std::size_t count = 0;
+        jsoncons::json_string_cursor cursor(input);
+        compiled.validate(cursor,
+            [&](const jsonschema::validation_message&) -> jsonschema::walk_result
+            {
+                ++count;
+                return jsonschema::walk_result::abort;
+            });
+        CHECK(count == 1);
+
+        jsoncons::json_string_cursor cursor2(input);
+        CHECK_FALSE(compiled.is_valid(cursor2));
+    }
+
+    SECTION("visitor")
+    {
+        std::vector<std::string> messages;
+        jsonschema::stream_validator<json> validator(compiled,
+            [&](const jsonschema::validation_message& msg) -> jsonschema::walk_result
+            {
+                messages.push_back(msg.instance_location().string());
+                return jsonschema::walk_result::advance;
+            });
+        jsoncons::json_string_reader reader(R"({"name": "ab", "point": {"x": 1, "y": 2}, "tags": [true]})", validator);
+        reader.read();
+        CHECK(validator.done());
+        CHECK(validator.error_count() == 1);
+        CHECK(messages == std::vector<std::string>{"/tags/0"});
+    }
+
+    SECTION("messages are reported before the end of the document")
+    {
+        std::size_t count = 0;
+        jsonschema::stream_validator<json> validator(compiled,
+            [&](const jsonschema::validation_message&) -> jsonschema::walk_result
+            {
+                ++count;
+                return jsonschema::walk_result::advance;
+            });
+        validator.begin_object();
+        validator.key("tags");
+        validator.begin_array();
+        validator.string_value("a");
+        validator.int64_value(1);
+        CHECK(count == 1);
+        validator.string_value("b");
+        validator.end_array();
+        validator.key("name");
+        validator.string_value("a");
+        CHECK(count == 2);
+        CHECK_FALSE(validator.done());
+        validator.end_object();
+        CHECK(validator.done());
+        CHECK(count == 3); // point is required
+    }
+
+    SECTION("cbor")
+    {
+        json doc = json::parse(R"({"name": "ab", "point": {"x": 1, "y": 2}, "tags": ["a", "b", "c", "d"]})");
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(doc, data);
+
+        cbor::cbor_bytes_cursor cursor(data);
+        CHECK_FALSE(compiled.is_valid(cursor));
+    }
+}
+
+TEST_CASE("jsonschema stream_validator test suite")
+{
+    std::vector<std::string> names = {
+        "additionalProperties", "allOf", "anchor", "anyOf", "boolean_schema", "const", "contains",
+        "defs", "dependentRequired", "dependentSchemas", "dynamicRef", "enum", "exclusiveMaximum", "exclusiveMinimum",
+        "if-then-else", "infinite-loop-detection", "items", "maxContains", "maxItems", "maxLength", "maxProperties",
+        "maximum", "minContains", "minItems", "minLength", "minProperties", "minimum", "multipleOf", "not", "oneOf",
+        "pattern", "patternProperties", "prefixItems", "properties", "propertyNames", "ref", "refRemote", "required",
+        "type", "unevaluatedItems", "unevaluatedProperties", "uniqueItems"
+    };
+    for (const auto& name : names)
+    {
+        stream_tests("./jsonschema/JSON-Schema-Test-Suite/tests/draft2020-12/" + name + ".json");
+    }
+}
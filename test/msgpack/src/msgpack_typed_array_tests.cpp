@@ -0,0 +1,146 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons/json.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+namespace {
+
+    // ext type of a typed array whose elements are in native byte order
+    uint8_t native_tag(uint8_t big_endian_tag)
+    {
+        return jsoncons::endian::native == jsoncons::endian::big ? big_endian_tag : static_cast<uint8_t>(big_endian_tag + 4);
+    }
+
+} // namespace
+
+TEST_CASE("msgpack encode typed arrays")
+{
+    auto options = msgpack::msgpack_options{}.use_typed_arrays(true);
+
+    SECTION("double")
+    {
+        std::vector<double> v = {1.5, -2.0, 3.25};
+        std::vector<uint8_t> data;
+        msgpack::encode_msgpack(v, data, options);
+
+        std::vector<uint8_t> expected = {0xc7, 24, native_tag(0x52)}; // ext 8
+        expected.resize(3 + 24);
+        std::memcpy(expected.data() + 3, v.data(), 24);
+        CHECK(data == expected);
+    }
+
+    SECTION("int16 fixext")
+    {
+        std::vector<int16_t> v = {1, -1};
+        std::vector<uint8_t> data;
+        msgpack::encode_msgpack(v, data, options);
+
+        std::vector<uint8_t> expected = {0xd6, native_tag(0x49)}; // fixext 4
+        expected.resize(2 + 4);
+        std::memcpy(expected.data() + 2, v.data(), 4);
+        CHECK(data == expected);
+    }
+
+    SECTION("uint8")
+    {
+        std::vector<uint8_t> v = {1, 2, 3};
+        std::vector<uint8_t> data;
+        msgpack::msgpack_bytes_encoder encoder(data, options);
+        encoder.typed_array(jsoncons::span<const uint8_t>(v));
+        encoder.flush();
+
+        std::vector<uint8_t> expected = {0xc7, 3, 0x40, 1, 2, 3};
+        CHECK(data == expected);
+    }
+
+    SECTION("without use_typed_arrays")
+    {
+        std::vector<int16_t> v = {256, -256, 1};
+        std::vector<uint8_t> data;
+        msgpack::encode_msgpack(v, data);
+
+        std::vector<uint8_t> expected;
+        msgpack::encode_msgpack(json::parse("[256,-256,1]"), expected);
+        CHECK(data == expected);
+    }
+}
+
+TEST_CASE("msgpack decode typed arrays")
+{
+    auto options = msgpack::msgpack_options{}.use_typed_arrays(true);
+
+    SECTION("big and little endian")
+    {
+        const std::vector<uint8_t> input = {0x92, // array of length 2
+                                            0xd6, 0x49, 0x01, 0x00, 0xff, 0x00, // int16 big endian
+                                            0xd6, 0x4d, 0x01, 0x00, 0xff, 0x00}; // int16 little endian
+
+        json j = msgpack::decode_msgpack<json>(input, options);
+        CHECK(j == json::parse("[[256,-256],[1,255]]"));
+
+        msgpack::msgpack_bytes_cursor cursor(input, options);
+        cursor.next();
+        CHECK(cursor.is_typed_array());
+        std::vector<int16_t> v;
+        std::error_code ec;
+        REQUIRE(cursor.read_typed_array(v, ec));
+        CHECK(v == std::vector<int16_t>{256, -256});
+        cursor.next();
+        REQUIRE(cursor.read_typed_array(v, ec));
+        CHECK(v == std::vector<int16_t>{1, 255});
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+    }
+
+    SECTION("without use_typed_arrays")
+    {
+        const std::vector<uint8_t> input = {0xd6, 0x49, 0x01, 0x00, 0xff, 0x00};
+
+        json j = msgpack::decode_msgpack<json>(input);
+        CHECK(j.is_byte_string());
+        CHECK(j.tag() == semantic_tag::ext);
+        CHECK(j.ext_tag() == 0x49);
+    }
+
+    SECTION("not a whole number of elements")
+    {
+        const std::vector<uint8_t> input = {0xc7, 3, 0x49, 0x01, 0x00, 0xff};
+
+        json j = msgpack::decode_msgpack<json>(input, options);
+        CHECK(j.is_byte_string());
+        CHECK(j.ext_tag() == 0x49);
+    }
+
+    SECTION("round trip")
+    {
+        std::vector<double> doubles(1000);
+        for (std::size_t i = 0; i < doubles.size(); ++i)
+        {
+            doubles[i] = static_cast<double>(i) * 0.5 - 100.0;
+        }
+
+        std::vector<uint8_t> data;
+        msgpack::encode_msgpack(doubles, data, options);
+        CHECK(msgpack::decode_msgpack<std::vector<double>>(data, options) == doubles);
+        CHECK(msgpack::decode_msgpack<json>(data, options).as<std::vector<double>>() == doubles);
+
+        std::ostringstream os;
+        msgpack::encode_msgpack(doubles, os, options);
+        std::istringstream is(os.str());
+        CHECK(msgpack::decode_msgpack<std::vector<double>>(is, options) == doubles);
+    }
+}
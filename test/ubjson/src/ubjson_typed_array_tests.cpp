@@ -0,0 +1,164 @@
+// Copyright 2013-2025 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+
+#include <jsoncons_ext/ubjson/ubjson.hpp>
+#include <jsoncons/json.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+TEST_CASE("ubjson encode typed arrays")
+{
+    auto options = ubjson::ubjson_options{}.use_typed_arrays(true);
+
+    SECTION("int16")
+    {
+        std::vector<int16_t> v = {256, -256, 1};
+        std::vector<uint8_t> data;
+        ubjson::encode_ubjson(v, data, options);
+
+        std::vector<uint8_t> expected = {'[','$','I','#','U',3,
+                                         0x01,0x00, 
+                                         0xff,0x00,
+                                         0x00,0x01};
+        CHECK(data == expected);
+        CHECK(ubjson::decode_ubjson<json>(data) == json::parse("[256,-256,1]"));
+    }
+
+    SECTION("double")
+    {
+        std::vector<double> v = {-1.0, 0.0};
+        std::vector<uint8_t> data;
+        ubjson::encode_ubjson(v, data, options);
+
+        std::vector<uint8_t> expected = {'[','$','D','#','U',2,
+                                         0xbf,0xf0,0,0,0,0,0,0,
+                                         0,0,0,0,0,0,0,0};
+        CHECK(data == expected);
+    }
+
+    SECTION("uint8 and int8")
+    {
+        std::vector<uint8_t> data;
+        ubjson::ubjson_bytes_encoder encoder(data, options);
+        encoder.begin_array(2);
+        std::vector<uint8_t> u = {0, 255};
+        encoder.typed_array(jsoncons::span<const uint8_t>(u));
+        std::vector<int8_t> i = {-1, 127};
+        encoder.typed_array(jsoncons::span<const int8_t>(i));
+        encoder.end_array();
+        encoder.flush();
+
+        std::vector<uint8_t> expected = {'[','#','U',2,
+                                         '[','$','U','#','U',2,0,255,
+                                         '[','$','i','#','U',2,0xff,127};
+        CHECK(data == expected);
+    }
+
+    SECTION("without use_typed_arrays")
+    {
+        std::vector<int16_t> v = {256, -256, 1};
+        std::vector<uint8_t> data;
+        ubjson::encode_ubjson(v, data);
+
+        std::vector<uint8_t> expected;
+        ubjson::encode_ubjson(json::parse("[256,-256,1]"), expected);
+        CHECK(data == expected);
+    }
+}
+
+TEST_CASE("ubjson cursor read_typed_array tests")
+{
+    const std::vector<uint8_t> input = {'[','#','U',2,
+                                        '[','$','I','#','U',2,
+                                        0x01,0x00, // 256
+                                        0xff,0x00, // -256
+                                        'S','U',1,'a'};
+
+    SECTION("matching element type")
+    {
+        ubjson::ubjson_bytes_cursor cursor(input);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        CHECK(cursor.is_typed_array());
+
+        std::vector<int16_t> v;
+        std::error_code ec;
+        REQUIRE(cursor.read_typed_array(v, ec));
+        CHECK_FALSE(ec);
+        CHECK(v == std::vector<int16_t>{256, -256});
+
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::string_value);
+        CHECK(cursor.current().get<std::string>() == "a");
+    }
+
+    SECTION("other element type")
+    {
+        ubjson::ubjson_bytes_cursor cursor(input);
+        cursor.next();
+
+        std::vector<int32_t> v;
+        std::error_code ec;
+        CHECK_FALSE(cursor.read_typed_array(v, ec));
+
+        std::vector<int64_t> values;
+        cursor.next();
+        while (cursor.current().event_type() != staj_event_type::end_array)
+        {
+            values.push_back(cursor.current().get<int64_t>());
+            cursor.next();
+        }
+        CHECK(values == std::vector<int64_t>{256, -256});
+    }
+
+    SECTION("truncated")
+    {
+        std::vector<uint8_t> truncated(input.begin(), input.begin() + 12);
+        std::error_code ec;
+        ubjson::ubjson_bytes_cursor cursor(truncated, ec);
+        cursor.next(ec);
+        CHECK(ec == ubjson::ubjson_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("ubjson decode typed arrays")
+{
+    std::vector<double> doubles(1000);
+    std::vector<int32_t> ints(100000);
+    for (std::size_t i = 0; i < doubles.size(); ++i)
+    {
+        doubles[i] = static_cast<double>(i) * 0.5 - 100.0;
+    }
+    for (std::size_t i = 0; i < ints.size(); ++i)
+    {
+        ints[i] = static_cast<int32_t>(i) * -7;
+    }
+    auto options = ubjson::ubjson_options{}.use_typed_arrays(true);
+
+    std::vector<uint8_t> data;
+    ubjson::encode_ubjson(doubles, data, options);
+    CHECK(ubjson::decode_ubjson<std::vector<double>>(data) == doubles);
+    CHECK(ubjson::decode_ubjson<json>(data).as<std::vector<double>>() == doubles);
+
+    std::ostringstream os;
+    ubjson::encode_ubjson(ints, os, options);
+    std::string s = os.str();
+    std::istringstream is(s);
+    CHECK(ubjson::decode_ubjson<std::vector<int32_t>>(is) == ints);
+
+    // Elements of another type go through decode_traits
+    auto wide = ubjson::decode_ubjson<std::vector<int64_t>>(std::vector<uint8_t>(s.begin(), s.end()));
+    REQUIRE(wide.size() == ints.size());
+    CHECK(std::equal(wide.begin(), wide.end(), ints.begin()));
+}